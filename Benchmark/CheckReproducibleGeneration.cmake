@@ -0,0 +1,42 @@
+# Generate the same corpus under two different root directories and check that the generated files are identical byte for byte.
+# Usage: cmake -DBENCHMARK=<DariusBenchmark path> -DWORK_DIR=<directory> -DHEADER_COUNT=<count> -P CheckReproducibleGeneration.cmake
+
+set(Roots ${WORK_DIR}/RootA ${WORK_DIR}/OtherLocation/RootB)
+
+foreach (Root ${Roots})
+	file(REMOVE_RECURSE ${Root})
+
+	execute_process(COMMAND ${BENCHMARK} --headers=${HEADER_COUNT} --dir=${Root}
+					RESULT_VARIABLE Result)
+
+	if (NOT Result EQUAL 0)
+		message(FATAL_ERROR "Generation failed in ${Root}")
+	endif()
+endforeach()
+
+list(GET Roots 0 RootA)
+list(GET Roots 1 RootB)
+
+file(GLOB_RECURSE FilesA RELATIVE ${RootA}/Generated ${RootA}/Generated/*)
+file(GLOB_RECURSE FilesB RELATIVE ${RootB}/Generated ${RootB}/Generated/*)
+
+if (NOT FilesA STREQUAL FilesB)
+	message(FATAL_ERROR "Different files were generated in ${RootA} and ${RootB}")
+endif()
+
+set(DifferentFiles)
+foreach (File ${FilesA})
+	execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${RootA}/Generated/${File} ${RootB}/Generated/${File}
+					RESULT_VARIABLE Different)
+
+	if (Different)
+		list(APPEND DifferentFiles ${File})
+	endif()
+endforeach()
+
+if (DifferentFiles)
+	message(FATAL_ERROR "Generated files depend on the root directory: ${DifferentFiles}")
+endif()
+
+list(LENGTH FilesA FileCount)
+message(STATUS "${FileCount} generated files are identical in ${RootA} and ${RootB}")
\ No newline at end of file
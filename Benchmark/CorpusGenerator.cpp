@@ -0,0 +1,181 @@
+#include "CorpusGenerator.h"
+
+#include <array>
+#include <fstream>
+#include <cstdio>	//std::snprintf
+
+/** Properties cycled through when reflecting fields. */
+static constexpr std::array<char const*, 3> fieldProperties = { "Serialize", "Get[inline]", "Set[inline]" };
+
+/** Field types cycled through by the generated types. */
+static constexpr std::array<char const*, 5> fieldTypes = { "float", "int", "bool", "double", "unsigned int" };
+
+static bool writeFile(fs::path const& path, std::string const& content) noexcept
+{
+	std::ofstream file(path, std::ios::out | std::ios::trunc);
+
+	if (!file.is_open())
+		return false;
+
+	file << content;
+
+	return file.good();
+}
+
+CorpusGenerator::CorpusGenerator(CorpusSettings const& settings) noexcept:
+	_settings{settings}
+{
+}
+
+std::string CorpusGenerator::getHeaderName(std::size_t index) noexcept
+{
+	char name[32];
+	std::snprintf(name, sizeof(name), "Header%05zu", index);
+
+	return name;
+}
+
+bool CorpusGenerator::writeCommonHeader(fs::path const& includeDirectory) const noexcept
+{
+	std::string content =
+		"#pragma once\n"
+		"\n"
+		"#define BODY_MACRO_COMBINE_INNER(A,B,C,D) A##B##C##D\n"
+		"#define BODY_MACRO_COMBINE(A,B,C,D) BODY_MACRO_COMBINE_INNER(A,B,C,D)\n"
+		"#if CODEGEN_BUILD\n"
+		"#define GENERATED_BODY() class DClass() __CodeGenIdentifier__;\n"
+		"#else\n"
+		"#define GENERATED_BODY() BODY_MACRO_COMBINE(CURRENT_FILE_ID,_,__LINE__,_GENERATED_BODY)\n"
+		"#endif\n";
+
+	std::error_code errorCode;
+	fs::create_directories(includeDirectory / "Utils", errorCode);
+
+	return writeFile(includeDirectory / "Utils" / "Common.hpp", content);
+}
+
+void CorpusGenerator::appendField(std::string& inout_content, std::size_t fieldIndex, std::size_t headerIndex, std::string const& indent) const noexcept
+{
+	std::string const fieldName = "Field" + std::to_string(fieldIndex);
+
+	//Leave one field out of four unreflected, like real headers do
+	if (_settings.propertiesPerField != 0u && fieldIndex % 4u != 3u)
+	{
+		inout_content += indent + "DField(";
+
+		for (std::size_t i = 0u; i < _settings.propertiesPerField && i < fieldProperties.size(); i++)
+		{
+			if (i != 0u)
+				inout_content += ", ";
+
+			inout_content += fieldProperties[(fieldIndex + headerIndex + i) % fieldProperties.size()];
+		}
+
+		inout_content += ")\n" + indent + "\t";
+	}
+	else
+	{
+		inout_content += indent;
+	}
+
+	inout_content += std::string(fieldTypes[(fieldIndex + headerIndex) % fieldTypes.size()]) + "\t" + fieldName + ";\n";
+}
+
+void CorpusGenerator::appendType(std::string& inout_content, std::string const& keyword, std::string const& macro, std::string const& name,
+								 std::size_t headerIndex, std::size_t depth, std::string const& indent) const noexcept
+{
+	inout_content += indent + keyword + " " + macro + " " + name + "\n";
+	inout_content += indent + "{\n";
+	inout_content += indent + "\tGENERATED_BODY();\n\n";
+
+	if (keyword == "class")
+		inout_content += indent + "public:\n";
+
+	for (std::size_t i = 0u; i < _settings.fieldsPerType; i++)
+	{
+		appendField(inout_content, i, headerIndex, indent + "\t");
+	}
+
+	for (std::size_t i = 0u; i < _settings.templatesPerHeader; i++)
+	{
+		inout_content += indent + "\tDField(Serialize)\n";
+		inout_content += indent + "\t\tTemplate" + std::to_string(i) + "<float>\tTemplateField" + std::to_string(i) + ";\n";
+	}
+
+	if (depth < _settings.nestingDepth)
+	{
+		inout_content += "\n";
+		appendType(inout_content, "struct", "DStruct(Serialize)", "Nested" + std::to_string(depth), headerIndex, depth + 1u, indent + "\t");
+	}
+
+	inout_content += indent + "};\n\n";
+}
+
+bool CorpusGenerator::writeHeader(fs::path const& includeDirectory, std::size_t index) const noexcept
+{
+	std::string const	headerName = getHeaderName(index);
+	std::string			content;
+
+	content += "#pragma once\n\n";
+	content += "#include \"Utils/Common.hpp\"\n";
+
+	//Include the previously emitted headers
+	for (std::size_t i = 1u; i <= _settings.includeFanOut && i <= index; i++)
+	{
+		content += "#include \"" + getHeaderName(index - i) + ".hpp\"\n";
+	}
+
+	content += "\n#include \"Generated/" + headerName + ".generated.hpp\"\n\n";
+	content += "namespace Darius::Benchmark::" + headerName + "\n{\n";
+
+	for (std::size_t i = 0u; i < _settings.templatesPerHeader; i++)
+	{
+		content += "\ttemplate <typename T>\n";
+		content += "\tstruct Template" + std::to_string(i) + "\n\t{\n\t\tT\tValue;\n\t};\n\n";
+	}
+
+	for (std::size_t i = 0u; i < _settings.enumsPerHeader; i++)
+	{
+		content += "\tenum class DEnum(Serialize) Enum" + std::to_string(i) + "\n\t{\n";
+
+		for (std::size_t j = 0u; j < _settings.valuesPerEnum; j++)
+		{
+			content += "\t\tValue" + std::to_string(j) + ",\n";
+		}
+
+		content += "\t};\n\n";
+	}
+
+	for (std::size_t i = 0u; i < _settings.structsPerHeader; i++)
+	{
+		appendType(content, "struct", "DStruct(Serialize)", "Struct" + std::to_string(i), index, 0u, "\t");
+	}
+
+	for (std::size_t i = 0u; i < _settings.classesPerHeader; i++)
+	{
+		appendType(content, "class", "DClass(Serialize, Reg)", "Class" + std::to_string(i), index, 0u, "\t");
+	}
+
+	content += "}\n";
+
+	return writeFile(includeDirectory / (headerName + ".hpp"), content);
+}
+
+bool CorpusGenerator::generate(fs::path const& includeDirectory) const noexcept
+{
+	std::error_code errorCode;
+
+	//Start from a clean directory so that stale headers from a bigger corpus don't get parsed
+	fs::remove_all(includeDirectory, errorCode);
+
+	if (!fs::create_directories(includeDirectory, errorCode) || !writeCommonHeader(includeDirectory))
+		return false;
+
+	for (std::size_t i = 0u; i < _settings.headerCount; i++)
+	{
+		if (!writeHeader(includeDirectory, i))
+			return false;
+	}
+
+	return true;
+}
\ No newline at end of file
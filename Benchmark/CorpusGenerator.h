@@ -0,0 +1,94 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+#include <Kodgen/Misc/Filesystem.h>
+
+/**
+*	Shape of the synthetic header corpus.
+*	Every header is written in the style of Test/TestStruct.hpp so that it goes through the same parsing and generation path as real Darius headers.
+*/
+struct CorpusSettings
+{
+	/** Number of headers to emit. */
+	std::size_t	headerCount			= 100u;
+
+	/** Number of DClass types per header. */
+	std::size_t	classesPerHeader	= 2u;
+
+	/** Number of DStruct types per header. */
+	std::size_t	structsPerHeader	= 2u;
+
+	/** Number of DEnum types per header. */
+	std::size_t	enumsPerHeader		= 1u;
+
+	/** Number of fields per DClass/DStruct. */
+	std::size_t	fieldsPerType		= 8u;
+
+	/** Number of enum values per DEnum. */
+	std::size_t	valuesPerEnum		= 8u;
+
+	/** Number of properties attached to each reflected field (0 leaves the field unreflected). */
+	std::size_t	propertiesPerField	= 2u;
+
+	/** Depth of the DStruct nested inside each DClass/DStruct (0 for no nesting). */
+	std::size_t	nestingDepth		= 1u;
+
+	/** Number of class templates per header. Reflected types get one field per template instantiation. */
+	std::size_t	templatesPerHeader	= 1u;
+
+	/** Number of previously emitted headers included by each header. */
+	std::size_t	includeFanOut		= 2u;
+};
+
+class CorpusGenerator
+{
+	private:
+		CorpusSettings	_settings;
+
+		/**
+		*	@brief Write the header shared by the whole corpus (GENERATED_BODY & co).
+		*/
+		bool		writeCommonHeader(fs::path const& includeDirectory)							const	noexcept;
+
+		/**
+		*	@brief Write the index-th header of the corpus.
+		*/
+		bool		writeHeader(fs::path const& includeDirectory, std::size_t index)				const	noexcept;
+
+		/**
+		*	@brief Append a DClass or DStruct definition (and its nested structs) to inout_content.
+		*/
+		void		appendType(std::string&			inout_content,
+							   std::string const&	keyword,
+							   std::string const&	macro,
+							   std::string const&	name,
+							   std::size_t			headerIndex,
+							   std::size_t			depth,
+							   std::string const&	indent)										const	noexcept;
+
+		/**
+		*	@brief Append a reflected or unreflected field to inout_content.
+		*/
+		void		appendField(std::string&		inout_content,
+								std::size_t			fieldIndex,
+								std::size_t			headerIndex,
+								std::string const&	indent)										const	noexcept;
+
+	public:
+		CorpusGenerator(CorpusSettings const& settings) noexcept;
+
+		/**
+		*	@brief Get the name (without extension) of the index-th header.
+		*/
+		static std::string	getHeaderName(std::size_t index)											noexcept;
+
+		/**
+		*	@brief	Emit the corpus in includeDirectory, replacing any previously generated corpus.
+		*			Headers are written at the root of includeDirectory and include their generated file through "Generated/<name>.generated.hpp".
+		* 
+		*	@return true if all files could be written, else false.
+		*/
+		bool				generate(fs::path const& includeDirectory)							const	noexcept;
+};
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include "MicroBenchmark.h"
+
+#include <fstream>
+#include <new>
+#include <cstdio>	//std::printf, std::snprintf
+#include <cstdlib>	//std::strtod, std::strtoull, std::malloc, std::free
+
+/** Number of calls to the global operator new, atomic since libclang may allocate from its own threads. */
+static std::atomic<std::uint64_t> allocationCount = 0u;
+
+void* operator new(std::size_t size)
+{
+	allocationCount.fetch_add(1u, std::memory_order_relaxed);
+
+	if (void* memory = std::malloc((size == 0u) ? 1u : size))
+		return memory;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t /* size */) noexcept
+{
+	std::free(memory);
+}
+
+std::uint64_t getAllocationCount() noexcept
+{
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+MicroBenchmarkRunner::MicroBenchmarkRunner(double minDuration, std::string filter) noexcept:
+	_minDuration{minDuration},
+	_filter{std::move(filter)}
+{
+}
+
+void MicroBenchmarkRunner::report(MicroBenchmarkResult const& result) const noexcept
+{
+	for (MicroBenchmarkResult const& before : _baseline)
+	{
+		if (before.name == result.name)
+		{
+			double change = (before.nanosecondsPerIteration > 0.0) ? (result.nanosecondsPerIteration / before.nanosecondsPerIteration - 1.0) * 100.0 : 0.0;
+
+			std::printf("%-60s %12.1f ns %10.2f allocs %14llu iterations   (before: %.1f ns, %.2f allocs, %+.1f%%)\n", result.name.c_str(), result.nanosecondsPerIteration,
+						result.allocationsPerIteration, static_cast<unsigned long long>(result.iterations), before.nanosecondsPerIteration, before.allocationsPerIteration, change);
+			return;
+		}
+	}
+
+	std::printf("%-60s %12.1f ns %10.2f allocs %14llu iterations\n", result.name.c_str(), result.nanosecondsPerIteration, result.allocationsPerIteration,
+				static_cast<unsigned long long>(result.iterations));
+}
+
+/**
+*	@brief Extract the raw value of the "key": value pair of a JSON line.
+*/
+static std::string getJsonValue(std::string const& line, std::string const& key) noexcept
+{
+	std::string::size_type index = line.find("\"" + key + "\":");
+
+	if (index == std::string::npos)
+		return "";
+
+	index = line.find_first_not_of(' ', index + key.size() + 3u);
+
+	if (index == std::string::npos)
+		return "";
+
+	if (line[index] == '"')
+	{
+		std::string::size_type end = line.find('"', index + 1u);
+
+		return (end == std::string::npos) ? "" : line.substr(index + 1u, end - index - 1u);
+	}
+
+	return line.substr(index, line.find_first_of(",}", index) - index);
+}
+
+bool MicroBenchmarkRunner::loadBaseline(fs::path const& path) noexcept
+{
+	std::ifstream file(path);
+
+	if (!file.is_open())
+		return false;
+
+	//saveResults writes one benchmark per line
+	std::string line;
+	while (std::getline(file, line))
+	{
+		std::string name = getJsonValue(line, "name");
+
+		if (!name.empty())
+		{
+			_baseline.push_back(MicroBenchmarkResult{ name,
+													  std::strtoull(getJsonValue(line, "iterations").c_str(), nullptr, 10),
+													  std::strtod(getJsonValue(line, "real_time").c_str(), nullptr),
+													  std::strtod(getJsonValue(line, "allocations_per_iteration").c_str(), nullptr) });
+		}
+	}
+
+	return true;
+}
+
+bool MicroBenchmarkRunner::saveResults(fs::path const& path) const noexcept
+{
+	std::ofstream file(path, std::ios::out | std::ios::trunc);
+
+	if (!file.is_open())
+		return false;
+
+	file << "{\n\t\"benchmarks\": [\n";
+
+	//Benchmarks are single-threaded, so the wall time is reported as cpu_time as well
+	for (std::size_t i = 0u; i < _results.size(); i++)
+	{
+		char line[512];
+		std::snprintf(line, sizeof(line), "\t\t{\"name\": \"%s\", \"iterations\": %llu, \"real_time\": %.3f, \"cpu_time\": %.3f, \"time_unit\": \"ns\", \"allocations_per_iteration\": %.3f}%s\n",
+					  _results[i].name.c_str(), static_cast<unsigned long long>(_results[i].iterations),
+					  _results[i].nanosecondsPerIteration, _results[i].nanosecondsPerIteration, _results[i].allocationsPerIteration, (i + 1u < _results.size()) ? "," : "");
+
+		file << line;
+	}
+
+	file << "\t]\n}\n";
+
+	return file.good();
+}
+
+std::vector<MicroBenchmarkResult> const& MicroBenchmarkRunner::getResults() const noexcept
+{
+	return _results;
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <atomic>	//std::atomic_signal_fence
+
+#include <Kodgen/Misc/Filesystem.h>
+
+/**
+*	@brief Prevent the compiler from optimizing away the computation of value.
+*/
+template <typename T>
+inline void doNotOptimize(T const& value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static volatile void const* sink;
+	sink = &value;
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+struct MicroBenchmarkResult
+{
+	/** Name of the benchmark. */
+	std::string		name;
+
+	/** Number of times the benchmarked function has been called. */
+	std::uint64_t	iterations				= 0u;
+
+	/** Average duration of a single call, in nanoseconds. */
+	double			nanosecondsPerIteration	= 0.0;
+
+	/** Average number of heap allocations performed by a single call. */
+	double			allocationsPerIteration	= 0.0;
+};
+
+/**
+*	@brief Get the number of calls to the global operator new since the program started.
+*/
+std::uint64_t getAllocationCount() noexcept;
+
+/**
+*	Minimal harness in the spirit of Google Benchmark: each benchmark is run in batches of growing size
+*	until it lasted at least the requested duration, and the average time per call is reported.
+*	Results can be saved as Google Benchmark compatible JSON and compared against a previous run.
+*/
+class MicroBenchmarkRunner
+{
+	private:
+		/** Minimum duration (in seconds) of the measured batch of each benchmark. */
+		double								_minDuration;
+
+		/** Only benchmarks which name contains this string are run. */
+		std::string							_filter;
+
+		/** Results of all benchmarks run so far. */
+		std::vector<MicroBenchmarkResult>	_results;
+
+		/** Results of a previous run, used to report before/after numbers. */
+		std::vector<MicroBenchmarkResult>	_baseline;
+
+		/**
+		*	@brief Log a result, along with its baseline if any.
+		*/
+		void	report(MicroBenchmarkResult const& result)	const	noexcept;
+
+	public:
+		MicroBenchmarkRunner(double minDuration, std::string filter)	noexcept;
+
+		/**
+		*	@brief Run function repeatedly and record the average time per call.
+		*
+		*	@param name		Name of the benchmark.
+		*	@param function	Function to benchmark. It is called without arguments.
+		*/
+		template <typename Function>
+		void								run(std::string const& name, Function&& function)	noexcept;
+
+		/**
+		*	@brief Load the results of a previous run written by saveResults.
+		* 
+		*	@return true if the file could be read, else false.
+		*/
+		bool								loadBaseline(fs::path const& path)					noexcept;
+
+		/**
+		*	@brief Write all results to a Google Benchmark compatible JSON file.
+		* 
+		*	@return true if the file could be written, else false.
+		*/
+		bool								saveResults(fs::path const& path)			const	noexcept;
+
+		/**
+		*	@brief Getter for _results.
+		*/
+		std::vector<MicroBenchmarkResult> const&	getResults()						const	noexcept;
+};
+
+template <typename Function>
+void MicroBenchmarkRunner::run(std::string const& name, Function&& function) noexcept
+{
+	if (!_filter.empty() && name.find(_filter) == std::string::npos)
+		return;
+
+	using Clock = std::chrono::steady_clock;
+
+	std::uint64_t	iterations	= 1u;
+	double			elapsed		= 0.0;
+	std::uint64_t	allocations	= 0u;
+
+	//Grow the batch until it is long enough to be measured reliably
+	while (true)
+	{
+		std::uint64_t		allocationsBefore	= getAllocationCount();
+		Clock::time_point	start				= Clock::now();
+
+		for (std::uint64_t i = 0u; i < iterations; i++)
+		{
+			function();
+		}
+
+		elapsed		= std::chrono::duration<double>(Clock::now() - start).count();
+		allocations	= getAllocationCount() - allocationsBefore;
+
+		if (elapsed >= _minDuration || iterations >= (std::uint64_t(1u) << 40))
+			break;
+
+		//Aim slightly above the min duration, growing at most 10x at once
+		double factor = (elapsed > 0.0) ? (_minDuration * 1.4 / elapsed) : 10.0;
+		iterations = static_cast<std::uint64_t>(iterations * ((factor < 10.0) ? ((factor > 2.0) ? factor : 2.0) : 10.0));
+	}
+
+	_results.push_back(MicroBenchmarkResult{ name, iterations, elapsed * 1e9 / iterations, static_cast<double>(allocations) / iterations });
+
+	report(_results.back());
+}
\ No newline at end of file
@@ -0,0 +1,342 @@
+#include <Kodgen/Parsing/PropertyParser.h>
+#include <Kodgen/InfoStructures/TypeInfo.h>
+#include <Kodgen/InfoStructures/EntityInfo.h>
+#include <Kodgen/InfoStructures/StructClassInfo.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnitSettings.h>
+#include <Kodgen/CodeGen/CodeWriter.h>
+#include <Kodgen/Parsing/ParsedDataScope.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdio>	//std::printf
+#include <cstdlib>	//std::strtod
+
+#include "MicroBenchmark.h"
+
+/** Optional flag used to save the results as JSON: --json=<path> */
+static constexpr std::string_view jsonFlag			= "--json=";
+
+/** Optional flag used to compare the results with a previously saved JSON: --baseline=<path> */
+static constexpr std::string_view baselineFlag		= "--baseline=";
+
+/** Optional flag used to only run the benchmarks which name contains the given string: --filter=<string> */
+static constexpr std::string_view filterFlag		= "--filter=";
+
+/** Optional flag used to set the minimum measured duration (in seconds) of each benchmark: --min-time=<seconds> */
+static constexpr std::string_view minTimeFlag		= "--min-time=";
+
+/** Header parsed with libclang to get representative TypeInfo / StructClassInfo instances. */
+static constexpr char const* typesSource =
+	"#include <cstddef>\n"
+	"namespace Darius::Renderer::Light\n"
+	"{\n"
+	"	template <typename T, int N> struct Array { T data[N]; };\n"
+	"	template <typename T> struct ResourceRef { T* ptr; };\n"
+	"	struct Texture {};\n"
+	"	class LightComponent\n"
+	"	{\n"
+	"		public:\n"
+	"		struct ShadowData { float bias; };\n"
+	"		float											Intensity;\n"
+	"		unsigned int const								Id = 0u;\n"
+	"		Darius::Renderer::Light::LightComponent::ShadowData	Shadow;\n"
+	"		ResourceRef<Texture>							Cookie;\n"
+	"		Array<ResourceRef<Texture>, 4> const*			Cascades;\n"
+	"		LightComponent::ShadowData volatile* const*		ShadowHistory;\n"
+	"	};\n"
+	"}\n";
+
+/** Subset of MacroCodeGenUnitSettings exposing its protected helpers to the benchmarks. */
+class MacroCodeGenUnitSettingsAccess : public kodgen::MacroCodeGenUnitSettings
+{
+	public:
+		using kodgen::MacroCodeGenUnitSettings::replaceTags;
+		using kodgen::MacroCodeGenUnitSettings::sanitizeMacroName;
+};
+
+/** Entities parsed from typesSource. */
+struct ParsedTypes
+{
+	std::vector<CXCursor>					fieldCursors;
+	std::vector<kodgen::TypeInfo>			fieldTypes;
+	std::vector<kodgen::StructClassInfo>	classes;
+};
+
+static std::string_view getFlagValue(int argc, char** argv, std::string_view flag) noexcept
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view arg(argv[i]);
+
+		if (arg.starts_with(flag))
+			return arg.substr(flag.size());
+	}
+
+	return std::string_view();
+}
+
+static CXChildVisitResult collectTypes(CXCursor cursor, CXCursor /* parentCursor */, CXClientData clientData) noexcept
+{
+	ParsedTypes& parsedTypes = *reinterpret_cast<ParsedTypes*>(clientData);
+
+	switch (clang_getCursorKind(cursor))
+	{
+		case CXCursorKind::CXCursor_FieldDecl:
+			parsedTypes.fieldCursors.emplace_back(cursor);
+			parsedTypes.fieldTypes.emplace_back(clang_getCursorType(cursor));
+			break;
+
+		case CXCursorKind::CXCursor_ClassDecl:
+		case CXCursorKind::CXCursor_StructDecl:
+			parsedTypes.classes.emplace_back(cursor, std::vector<kodgen::Property>(), false, false);
+			break;
+
+		default:
+			break;
+	}
+
+	return CXChildVisitResult::CXChildVisit_Recurse;
+}
+
+static void runPropertyParserBenchmarks(MicroBenchmarkRunner& runner) noexcept
+{
+	kodgen::PropertyParsingSettings propertyParsingSettings;
+	propertyParsingSettings.propertySeparator		= ',';
+	propertyParsingSettings.argumentEnclosers[0]	= '[';
+	propertyParsingSettings.argumentEnclosers[1]	= ']';
+	propertyParsingSettings.argumentSeparator		= ',';
+
+	kodgen::PropertyParser propertyParser;
+	propertyParser.setup(propertyParsingSettings);
+
+	std::array<std::pair<char const*, char const*>, 4> const annotations
+	{
+		std::make_pair("PropertyParser/Single", "KGF:Serialize"),
+		std::make_pair("PropertyParser/Arguments", "KGF:Serialize, Get[inline, const, &], Set[inline]"),
+		std::make_pair("PropertyParser/ManyProperties", "KGF:Serialize, Get[inline], Set[inline], Resource, Reg, Hidden, Category[Rendering], Range[0, 100, 0.5]"),
+		std::make_pair("PropertyParser/Spaces", "KGF:  Serialize ,   Get[ inline ,  const ,  & ] ,  Set[ inline ]  ")
+	};
+
+	for (auto const& [name, annotation] : annotations)
+	{
+		runner.run(name, [&propertyParser, annotation = std::string(annotation)]()
+				   {
+					   propertyParser.clean();
+					   doNotOptimize(propertyParser.getFieldProperties(annotation));
+				   });
+	}
+}
+
+static void runTypeInfoBenchmarks(MicroBenchmarkRunner& runner, ParsedTypes const& parsedTypes) noexcept
+{
+	runner.run("TypeInfo/getName", [&parsedTypes]()
+			   {
+				   for (kodgen::TypeInfo const& type : parsedTypes.fieldTypes)
+					   doNotOptimize(type.getName());
+			   });
+
+	runner.run("TypeInfo/getName/removeQualifiers", [&parsedTypes]()
+			   {
+				   for (kodgen::TypeInfo const& type : parsedTypes.fieldTypes)
+					   doNotOptimize(type.getName(true));
+			   });
+
+	runner.run("TypeInfo/getName/removeNamespacesAndNestedClasses", [&parsedTypes]()
+			   {
+				   for (kodgen::TypeInfo const& type : parsedTypes.fieldTypes)
+					   doNotOptimize(type.getName(false, true));
+			   });
+
+	runner.run("TypeInfo/getName/all", [&parsedTypes]()
+			   {
+				   for (kodgen::TypeInfo const& type : parsedTypes.fieldTypes)
+					   doNotOptimize(type.getName(true, true, true));
+			   });
+
+	runner.run("TypeInfo/getCanonicalName", [&parsedTypes]()
+			   {
+				   for (kodgen::TypeInfo const& type : parsedTypes.fieldTypes)
+					   doNotOptimize(type.getCanonicalName(true, true));
+			   });
+}
+
+static void runEntityConstructionBenchmarks(MicroBenchmarkRunner& runner, ParsedTypes const& parsedTypes) noexcept
+{
+	std::array<std::pair<char const*, kodgen::EParsedData>, 3> const parsedDataVariants
+	{
+		std::make_pair("EntityConstruction/All", kodgen::EParsedData::All),
+		std::make_pair("EntityConstruction/CanonicalTypeName+TypeLayout", kodgen::EParsedData::CanonicalTypeName | kodgen::EParsedData::TypeLayout),
+		std::make_pair("EntityConstruction/None", kodgen::EParsedData::None)
+	};
+
+	for (auto const& [name, parsedData] : parsedDataVariants)
+	{
+		runner.run(name, [&parsedTypes, parsedData = parsedData]()
+				   {
+					   kodgen::ParsedDataScope parsedDataScope(parsedData);
+
+					   for (CXCursor const& cursor : parsedTypes.fieldCursors)
+					   {
+						   doNotOptimize(kodgen::EntityInfo(cursor, std::vector<kodgen::Property>(), kodgen::EEntityType::Field));
+						   doNotOptimize(kodgen::TypeInfo(clang_getCursorType(cursor)));
+					   }
+				   });
+	}
+}
+
+static void runMacroCodeGenUnitSettingsBenchmarks(MicroBenchmarkRunner& runner, ParsedTypes const& parsedTypes) noexcept
+{
+	kodgen::MacroCodeGenUnitSettings settings;
+	settings.setGeneratedHeaderFileNamePattern("##FILENAME##.generated.hpp");
+	settings.setClassFooterMacroPattern("##CLASSFULLNAME##_GENERATED");
+	settings.setHeaderFileFooterMacroPattern("File_##FILENAME##_GENERATED");
+
+	fs::path const sourceFile = fs::path("Engine") / "Source" / "Renderer" / "Light" / "LightComponent.hpp";
+
+	runner.run("MacroCodeGenUnitSettings/replaceTags", []()
+			   {
+				   std::string macroName = "Darius::Renderer::Light::LightComponent::ShadowData_##CLASSNAME##_GENERATED";
+				   MacroCodeGenUnitSettingsAccess::replaceTags(macroName, "::", "_");
+				   MacroCodeGenUnitSettingsAccess::replaceTags(macroName, "##CLASSNAME##", "ShadowData");
+				   doNotOptimize(macroName);
+			   });
+
+	runner.run("MacroCodeGenUnitSettings/sanitizeMacroName", []()
+			   {
+				   std::string macroName = "File_Light-Component.v2_GENERATED";
+				   doNotOptimize(MacroCodeGenUnitSettingsAccess::sanitizeMacroName(macroName));
+			   });
+
+	runner.run("MacroCodeGenUnitSettings/getGeneratedHeaderFileName", [&settings, &sourceFile]()
+			   {
+				   doNotOptimize(settings.getGeneratedHeaderFileName(sourceFile));
+			   });
+
+	runner.run("MacroCodeGenUnitSettings/getHeaderFileFooterMacro", [&settings, &sourceFile]()
+			   {
+				   doNotOptimize(settings.getHeaderFileFooterMacro(sourceFile));
+			   });
+
+	runner.run("MacroCodeGenUnitSettings/getClassFooterMacro", [&settings, &parsedTypes]()
+			   {
+				   for (kodgen::StructClassInfo const& structClass : parsedTypes.classes)
+					   doNotOptimize(settings.getClassFooterMacro(structClass));
+			   });
+}
+
+static void runEntityInfoBenchmarks(MicroBenchmarkRunner& runner) noexcept
+{
+	//Darius::Renderer::Light::LightComponent::Intensity
+	std::array<kodgen::EntityInfo, 5> entities;
+	std::array<char const*, 5> const names = { "Darius", "Renderer", "Light", "LightComponent", "Intensity" };
+
+	for (std::size_t i = 0u; i < entities.size(); i++)
+	{
+		entities[i].name		= names[i];
+		entities[i].outerEntity	= (i == 0u) ? nullptr : &entities[i - 1u];
+	}
+
+	runner.run("EntityInfo/getFullName/depth1", [&entities]()
+			   {
+				   doNotOptimize(entities[0].getFullName());
+			   });
+
+	runner.run("EntityInfo/getFullName/depth5", [&entities]()
+			   {
+				   doNotOptimize(entities[4].getFullName());
+			   });
+}
+
+static void runCodeWriterBenchmarks(MicroBenchmarkRunner& runner) noexcept
+{
+	//Same lines as the Darius getter and RTTR registration code generators, for a class of 8 fields
+	std::string const			separator		= " \\\n";
+	std::string const			classFullName	= "Darius::Renderer::Light::LightComponent";
+	std::array<std::string, 8>	fieldNames		= { "mIntensity", "mRange", "mColor", "mCastsShadow", "mAngle", "mType", "mShadowBias", "mMask" };
+	std::string					result;
+
+	runner.run("CodeWriter/StringConcatenation", [&]()
+			   {
+				   result.clear();
+
+				   for (std::string const& fieldName : fieldNames)
+				   {
+					   std::string methodName = "Get" + fieldName.substr(1);
+
+					   result += "INLINE float " + methodName + "() const { return " + fieldName + "; }" + separator;
+					   result += "\n\t.property(\"" + fieldName.substr(1) + "\", &" + classFullName + "::" + fieldName + ")";
+				   }
+
+				   doNotOptimize(result);
+			   });
+
+	runner.run("CodeWriter/CodeWriter", [&]()
+			   {
+				   result.clear();
+
+				   kodgen::CodeWriter writer(result, separator, fieldNames.size() * 128u);
+
+				   for (std::string const& fieldName : fieldNames)
+				   {
+					   std::string_view officialName = std::string_view(fieldName).substr(1);
+
+					   writer.writeLine("INLINE float Get{}() const { return {}; }", officialName, fieldName);
+					   writer.write("\n\t.property(\"{}\", &{}::{})", officialName, classFullName, fieldName);
+				   }
+
+				   doNotOptimize(result);
+			   });
+}
+
+int main(int argc, char** argv)
+{
+	double					minDuration = 0.2;
+	std::string_view		minTime		= getFlagValue(argc, argv, minTimeFlag);
+
+	if (!minTime.empty())
+		minDuration = std::strtod(std::string(minTime).c_str(), nullptr);
+
+	MicroBenchmarkRunner	runner(minDuration, std::string(getFlagValue(argc, argv, filterFlag)));
+	fs::path				baselinePath	= getFlagValue(argc, argv, baselineFlag);
+	fs::path				jsonPath		= getFlagValue(argc, argv, jsonFlag);
+
+	if (!baselinePath.empty() && !runner.loadBaseline(baselinePath))
+		std::printf("Could not read the baseline %s\n", baselinePath.string().c_str());
+
+	//Parse representative types once
+	ParsedTypes			parsedTypes;
+	CXIndex				index			= clang_createIndex(0, 0);
+	CXUnsavedFile		unsavedFile		= { "MicroBenchmarkTypes.hpp", typesSource, static_cast<unsigned long>(std::char_traits<char>::length(typesSource)) };
+	char const* const	arguments[]		= { "-xc++", "-std=c++17" };
+	CXTranslationUnit	translationUnit	= nullptr;
+
+	if (clang_parseTranslationUnit2(index, unsavedFile.Filename, arguments, 2, &unsavedFile, 1, CXTranslationUnit_SkipFunctionBodies, &translationUnit) == CXError_Success)
+	{
+		clang_visitChildren(clang_getTranslationUnitCursor(translationUnit), &collectTypes, &parsedTypes);
+	}
+	else
+	{
+		std::printf("Could not parse the benchmarked types, TypeInfo benchmarks are skipped.\n");
+	}
+
+	runPropertyParserBenchmarks(runner);
+	runTypeInfoBenchmarks(runner, parsedTypes);
+	runEntityConstructionBenchmarks(runner, parsedTypes);
+	runMacroCodeGenUnitSettingsBenchmarks(runner, parsedTypes);
+	runEntityInfoBenchmarks(runner);
+	runCodeWriterBenchmarks(runner);
+
+	//TypeInfo instances don't hold any clang resource, it's safe to release the translation unit now
+	clang_disposeTranslationUnit(translationUnit);
+	clang_disposeIndex(index);
+
+	if (!jsonPath.empty() && !runner.saveResults(jsonPath))
+	{
+		std::printf("Could not write the results to %s\n", jsonPath.string().c_str());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
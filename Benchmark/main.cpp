@@ -0,0 +1,308 @@
+#include <Kodgen/CodeGen/CodeGenManager.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnit.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnitSettings.h>
+#include <Kodgen/Parsing/FileParser.h>
+#include <Kodgen/Misc/Filesystem.h>
+#include <Kodgen/Misc/DefaultLogger.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <charconv>	//std::from_chars
+#include <cstdlib>	//std::strtof
+#include <cstdio>	//std::snprintf
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "CorpusGenerator.h"
+#include "GetSetCGM.h"
+#include "GeneratorSetup.hpp"
+
+/** Optional flag used to choose where the corpus is generated: --dir=<path> */
+static constexpr std::string_view directoryFlag = "--dir=";
+
+/** Optional flag used to fail the benchmark on incremental generation regressions: --check */
+static constexpr std::string_view checkFlag = "--check";
+
+/** Optional flag used to set the maximum duration (in seconds) of the warm run when --check is provided: --warm-budget=<seconds> */
+static constexpr std::string_view warmBudgetFlag = "--warm-budget=";
+
+/** Last write time and size of each file of a directory. */
+using DirectorySnapshot = std::map<fs::path, std::pair<fs::file_time_type, std::uintmax_t>>;
+
+/**
+*	@brief Get the peak resident set size of the process, in bytes.
+*/
+static std::size_t getPeakResidentSetSize() noexcept
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters;
+
+	return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? counters.PeakWorkingSetSize : 0u;
+#else
+	rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0u;
+
+#if defined(__APPLE__)
+	return static_cast<std::size_t>(usage.ru_maxrss);			//Bytes on macOS
+#else
+	return static_cast<std::size_t>(usage.ru_maxrss) * 1024u;	//Kilobytes on Linux
+#endif
+#endif
+}
+
+/**
+*	@brief Read a --name=<count> argument into out_value. The value is left untouched if the argument is absent or invalid.
+*/
+static void readCountArgument(int argc, char** argv, std::string_view name, std::size_t& out_value) noexcept
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view arg(argv[i]);
+
+		if (arg.size() > name.size() + 3u && arg.starts_with("--") && arg.substr(2u, name.size()) == name && arg[name.size() + 2u] == '=')
+		{
+			std::string_view value = arg.substr(name.size() + 3u);
+			std::from_chars(value.data(), value.data() + value.size(), out_value);
+		}
+	}
+}
+
+static fs::path getCorpusDirectory(int argc, char** argv) noexcept
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view arg(argv[i]);
+
+		if (arg.starts_with(directoryFlag))
+			return fs::path(arg.substr(directoryFlag.size()));
+	}
+
+	return fs::current_path() / "DariusBenchmarkCorpus";
+}
+
+static bool hasFlag(int argc, char** argv, std::string_view flag) noexcept
+{
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::string_view(argv[i]) == flag)
+			return true;
+	}
+
+	return false;
+}
+
+static float getWarmBudget(int argc, char** argv) noexcept
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view arg(argv[i]);
+
+		if (arg.starts_with(warmBudgetFlag))
+			return std::strtof(arg.substr(warmBudgetFlag.size()).data(), nullptr);
+	}
+
+	//A no-op run only checks timestamps, so it should stay far below this
+	return 5.0f;
+}
+
+static DirectorySnapshot takeSnapshot(fs::path const& directory) noexcept
+{
+	DirectorySnapshot	snapshot;
+	std::error_code		errorCode;
+
+	for (fs::directory_entry const& entry : fs::recursive_directory_iterator(directory, errorCode))
+	{
+		if (entry.is_regular_file())
+		{
+			snapshot.emplace(entry.path(), std::make_pair(entry.last_write_time(), entry.file_size()));
+		}
+	}
+
+	return snapshot;
+}
+
+/**
+*	@brief Get all files which have been added, removed or modified between 2 snapshots.
+*/
+static std::vector<fs::path> getChangedFiles(DirectorySnapshot const& before, DirectorySnapshot const& after) noexcept
+{
+	std::vector<fs::path> changedFiles;
+
+	for (auto const& [path, state] : after)
+	{
+		auto it = before.find(path);
+
+		if (it == before.cend() || it->second != state)
+			changedFiles.push_back(path);
+	}
+
+	for (auto const& [path, state] : before)
+	{
+		if (after.find(path) == after.cend())
+			changedFiles.push_back(path);
+	}
+
+	return changedFiles;
+}
+
+/**
+*	@brief Get the files parsed during a run.
+*		   CodeGenResult::parsedFiles holds a file once per iteration of the code generation unit.
+*/
+static std::set<fs::path> getParsedFiles(kodgen::CodeGenResult const& result) noexcept
+{
+	return std::set<fs::path>(result.parsedFiles.cbegin(), result.parsedFiles.cend());
+}
+
+static bool check(kodgen::ILogger& logger, bool condition, std::string const& message) noexcept
+{
+	if (!condition)
+	{
+		logger.log("[Check] " + message, kodgen::ILogger::ELogSeverity::Error);
+	}
+
+	return condition;
+}
+
+static void logPhase(kodgen::ILogger& logger, std::string const& phase, kodgen::CodeGenResult const& result) noexcept
+{
+	std::size_t	parsedFiles		= getParsedFiles(result).size();
+	std::size_t	processedFiles	= parsedFiles + result.upToDateFiles.size();
+	float		filesPerSecond	= (result.duration > 0.0f) ? processedFiles / result.duration : 0.0f;
+
+	char line[256];
+	std::snprintf(line, sizeof(line), "[%s] %s, %zu parsed, %zu up-to-date, %.3fs, %.1f files/s, peak RSS %.1f MiB",
+				  phase.c_str(), result.completed ? "completed" : "FAILED", parsedFiles, result.upToDateFiles.size(),
+				  result.duration, filesPerSecond, getPeakResidentSetSize() / (1024.0 * 1024.0));
+
+	logger.log(line, result.completed ? kodgen::ILogger::ELogSeverity::Info : kodgen::ILogger::ELogSeverity::Error);
+}
+
+int main(int argc, char** argv)
+{
+	kodgen::DefaultLogger logger;
+
+	CorpusSettings corpusSettings;
+	readCountArgument(argc, argv, "headers", corpusSettings.headerCount);
+	readCountArgument(argc, argv, "classes", corpusSettings.classesPerHeader);
+	readCountArgument(argc, argv, "structs", corpusSettings.structsPerHeader);
+	readCountArgument(argc, argv, "enums", corpusSettings.enumsPerHeader);
+	readCountArgument(argc, argv, "fields", corpusSettings.fieldsPerType);
+	readCountArgument(argc, argv, "values", corpusSettings.valuesPerEnum);
+	readCountArgument(argc, argv, "properties", corpusSettings.propertiesPerField);
+	readCountArgument(argc, argv, "depth", corpusSettings.nestingDepth);
+	readCountArgument(argc, argv, "templates", corpusSettings.templatesPerHeader);
+	readCountArgument(argc, argv, "fanout", corpusSettings.includeFanOut);
+
+	if (corpusSettings.headerCount == 0u)
+	{
+		logger.log("The corpus must contain at least one header.", kodgen::ILogger::ELogSeverity::Error);
+		return EXIT_FAILURE;
+	}
+
+	fs::path includeDirectory	= getCorpusDirectory(argc, argv);
+	fs::path outputDirectory	= includeDirectory / "Generated";
+
+	logger.log("Generating " + std::to_string(corpusSettings.headerCount) + " headers in " + includeDirectory.string());
+
+	if (!CorpusGenerator(corpusSettings).generate(includeDirectory))
+	{
+		logger.log("Could not generate the corpus in " + includeDirectory.string(), kodgen::ILogger::ELogSeverity::Error);
+		return EXIT_FAILURE;
+	}
+
+	//Setup FileParser. Parsing logs are left out so that they don't weigh on the measures.
+	kodgen::FileParser fileParser;
+
+	auto& settings = fileParser.getSettings();
+	settings.addProjectIncludeDirectory(includeDirectory);
+
+	//Same file ids wherever the corpus is generated, like DariusCodeGenerator
+	settings.setProjectRootDirectory(includeDirectory);
+
+	if (!initParsingSettings(settings))
+	{
+		logger.log("Compiler could not be set because it is not supported on the current machine.", kodgen::ILogger::ELogSeverity::Error);
+		return EXIT_FAILURE;
+	}
+
+	//Setup code generation unit
+	kodgen::MacroCodeGenUnit codeGenUnit;
+	codeGenUnit.logger = &logger;
+
+	kodgen::MacroCodeGenUnitSettings cguSettings;
+	initCodeGenUnitSettings(outputDirectory, cguSettings);
+	codeGenUnit.setSettings(cguSettings);
+
+	GetSetCGM getSetCodeGenModule;
+	codeGenUnit.addModule(getSetCodeGenModule);
+
+	//Setup CodeGenManager
+	kodgen::CodeGenManager codeGenMgr;
+	codeGenMgr.logger = &logger;
+
+	initCodeGenManagerSettings(includeDirectory, codeGenMgr.settings);
+
+	//The common header doesn't hold any entity
+	codeGenMgr.settings.addIgnoredDirectory(includeDirectory / "Utils");
+
+	//Cold: nothing has been generated yet
+	kodgen::CodeGenResult coldResult = codeGenMgr.run(fileParser, codeGenUnit, false);
+	logPhase(logger, "Cold", coldResult);
+
+	//Warm: every file is up-to-date
+	DirectorySnapshot		coldSnapshot	= takeSnapshot(outputDirectory);
+	kodgen::CodeGenResult	warmResult		= codeGenMgr.run(fileParser, codeGenUnit, false);
+	DirectorySnapshot		warmSnapshot	= takeSnapshot(outputDirectory);
+	logPhase(logger, "Warm", warmResult);
+
+	//Touch: a single header has been modified since the last run
+	fs::path touchedFile = includeDirectory / (CorpusGenerator::getHeaderName(corpusSettings.headerCount / 2u) + ".hpp");
+	fs::last_write_time(touchedFile, fs::file_time_type::clock::now());
+
+	kodgen::CodeGenResult	touchResult		= codeGenMgr.run(fileParser, codeGenUnit, false);
+	DirectorySnapshot		touchSnapshot	= takeSnapshot(outputDirectory);
+	logPhase(logger, "Touch", touchResult);
+
+	bool succeeded = coldResult.completed && warmResult.completed && touchResult.completed;
+
+	//Incremental generation must only do the work required by the modified files
+	if (hasFlag(argc, argv, checkFlag))
+	{
+		float					warmBudget			= getWarmBudget(argc, argv);
+		std::vector<fs::path>	warmChangedFiles	= getChangedFiles(coldSnapshot, warmSnapshot);
+		std::error_code			errorCode;
+
+		succeeded &= check(logger, warmResult.parsedFiles.empty(), "Warm run parsed " + std::to_string(getParsedFiles(warmResult).size()) + " files instead of 0.");
+		succeeded &= check(logger, warmChangedFiles.empty(), "Warm run wrote " + std::to_string(warmChangedFiles.size()) + " files instead of 0.");
+		succeeded &= check(logger, warmResult.duration <= warmBudget, "Warm run took " + std::to_string(warmResult.duration) + "s, budget is " + std::to_string(warmBudget) + "s.");
+
+		std::set<fs::path> touchParsedFiles = getParsedFiles(touchResult);
+
+		succeeded &= check(logger, touchParsedFiles.size() == 1u && fs::equivalent(*touchParsedFiles.cbegin(), touchedFile, errorCode),
+						   "Touch run parsed " + std::to_string(touchParsedFiles.size()) + " files instead of only " + touchedFile.string() + ".");
+
+		fs::path touchedFileOutputs[] = { outputDirectory / cguSettings.getGeneratedHeaderFileName(touchedFile),
+										  outputDirectory / cguSettings.getGeneratedSourceFileName(touchedFile) };
+
+		for (fs::path const& changedFile : getChangedFiles(warmSnapshot, touchSnapshot))
+		{
+			succeeded &= check(logger, changedFile == touchedFileOutputs[0] || changedFile == touchedFileOutputs[1],
+							   "Touch run changed " + changedFile.string() + " which is not generated from " + touchedFile.string() + ".");
+		}
+
+		if (succeeded)
+			logger.log("[Check] Incremental generation only processed the modified files.");
+	}
+
+	return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
+#include "Kodgen/CodeGen/CodeWriter.h"
+
+#include "Utils.hpp"
+
+// Generates SerializeBinary / DeserializeBinary for DClass/DStruct(BinarySerialize).
+// Serializable POD fields contiguous in memory are copied with a single memcpy,
+// other serializable fields must provide SerializeBinary / DeserializeBinary themselves (i.e. BinarySerialize structs).
+class BinarySerializationCodeGen : public kodgen::MacroPropertyCodeGen
+{
+	// A single POD field copy (size != 0) or a nested field delegation (size == 0)
+	struct FieldRun
+	{
+		std::vector<kodgen::FieldInfo const*>	fields;
+		std::size_t								size = 0u;
+	};
+
+	static std::vector<FieldRun> ComputeFieldRuns(kodgen::StructClassInfo const& clazz)
+	{
+		std::vector<FieldRun> runs;
+
+		// Members generated by GENERATED_CODE() (i.e. the dirty mask) are not known at parse time, so runs can't span it
+		unsigned int generatedCodeLine = 0u;
+		for (auto const& innerClass : clazz.nestedClasses)
+			if (innerClass->name == "__CodeGenIdentifier__")
+				generatedCodeLine = innerClass->line;
+
+		for (auto const& field : clazz.fields)
+		{
+			if (field.isStatic || !IsFieldSerializable(field) || IsFieldConst(field))
+				continue;
+
+			// Layout is unknown if the field type is not POD or if its offset could not be computed
+			if (!field.type.isPOD || field.type.sizeInBytes == 0u || field.memoryOffset < 0)
+			{
+				runs.push_back(FieldRun{ { &field }, 0u });
+				continue;
+			}
+
+			if (!runs.empty() && runs.back().size != 0u)
+			{
+				FieldRun& run = runs.back();
+
+				// Extend the run only if there is no padding nor skipped field in between
+				if (run.fields.front()->memoryOffset + static_cast<kodgen::int64>(run.size) == field.memoryOffset &&
+					!(run.fields.back()->line < generatedCodeLine && generatedCodeLine < field.line))
+				{
+					run.fields.push_back(&field);
+					run.size += field.type.sizeInBytes;
+					continue;
+				}
+			}
+
+			runs.push_back(FieldRun{ { &field }, field.type.sizeInBytes });
+		}
+
+		return runs;
+	}
+
+public:
+	BinarySerializationCodeGen() noexcept :
+		kodgen::MacroPropertyCodeGen("BinarySerialize", kodgen::EEntityType::Class | kodgen::EEntityType::Struct)
+	{}
+
+	virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+	{
+		return kodgen::ECodeGenLocationMask::ClassFooter;
+	}
+
+	virtual bool initialGenerateHeaderFileHeaderCode(kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept override
+	{
+		if (!IsPropertyUsedInFile(*this, env))
+			return true;
+
+		kodgen::CodeWriter writer(inout_result, env.getSeparator());
+
+		writer.writeLine("#include <cstddef>");
+		writer.writeLine("#include <cstring>");
+		writer.writeLine("#include <vector>");
+
+		return true;
+	}
+
+	virtual bool generateClassFooterCodeForEntity(kodgen::EntityInfo const& entity,
+		kodgen::Property const& /* property */,
+		std::uint8_t			/* propertyIndex */,
+		kodgen::MacroCodeGenEnv& env,
+		std::string& inout_result) noexcept override
+	{
+		kodgen::StructClassInfo const& clazz = reinterpret_cast<kodgen::StructClassInfo const&>(entity);
+
+		std::vector<FieldRun> runs = ComputeFieldRuns(clazz);
+
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 512u + runs.size() * 256u);
+
+		// Append the serialized fields to out
+		writer.writeLine("public:");
+		writer.writeLine("INLINE void SerializeBinary(std::vector<std::byte>& out) const");
+		writer.writeLine("{");
+
+		for (FieldRun const& run : runs)
+		{
+			if (run.size == 0u)
+			{
+				writer.writeLine("\t{}.SerializeBinary(out);", run.fields.front()->name);
+				continue;
+			}
+
+			// The fields must still be contiguous, not only of the same sizes
+			writer.writeLine("\tstatic_assert(offsetof({}, {}) + sizeof({}) - offsetof({}, {}) == {}, \"Layout of {} changed since code generation\");",
+				clazz.name, run.fields.back()->name, run.fields.back()->name, clazz.name, run.fields.front()->name, run.size, clazz.name);
+
+			writer.writeLine("\tout.resize(out.size() + {});", run.size);
+			writer.writeLine("\tstd::memcpy(out.data() + out.size() - {}, &{}, {});", run.size, run.fields.front()->name, run.size);
+		}
+
+		writer.writeLine("}");
+
+		// Read the fields from [in, end), return the end of the read data or nullptr if [in, end) is too small
+		writer.writeLine("INLINE std::byte const* DeserializeBinary(std::byte const* in, std::byte const* end)");
+		writer.writeLine("{");
+
+		for (FieldRun const& run : runs)
+		{
+			if (run.size == 0u)
+			{
+				writer.writeLine("\tin = {}.DeserializeBinary(in, end);", run.fields.front()->name);
+				writer.writeLine("\tif (in == nullptr) return nullptr;");
+				continue;
+			}
+
+			writer.writeLine("\tif (end - in < {}) return nullptr;", run.size);
+			writer.writeLine("\tstd::memcpy(&{}, in, {});", run.fields.front()->name, run.size);
+			writer.writeLine("\tin += {};", run.size);
+		}
+
+		if (runs.empty())
+			writer.writeLine("\t(void)end;");
+
+		writer.writeLine("\treturn in;");
+		writer.writeLine("}");
+
+		return true;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <Kodgen/CodeGen/CodeGenManagerSettings.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnitSettings.h>
+#include <Kodgen/Parsing/ParsingSettings.h>
+#include <Kodgen/Misc/Filesystem.h>
+
+inline void initCodeGenUnitSettings(fs::path const& outputDirectory, kodgen::MacroCodeGenUnitSettings& out_cguSettings)
+{
+	//All generated files will be located in WorkingDir/Include/Generated
+	out_cguSettings.setOutputDirectory(outputDirectory);
+	
+	//Setup generated files name pattern
+	out_cguSettings.setGeneratedHeaderFileNamePattern("##FILENAME##.generated.hpp");
+	out_cguSettings.setGeneratedSourceFileNamePattern("##FILENAME##.sgenerated.hpp");
+	out_cguSettings.setClassFooterMacroPattern("##CLASSFULLNAME##_GENERATED");
+	out_cguSettings.setHeaderFileFooterMacroPattern("File_##FILENAME##_GENERATED");
+}
+
+inline void initCodeGenManagerSettings(fs::path const& workingDirectory, kodgen::CodeGenManagerSettings& out_generatorSettings)
+{
+	//Parse WorkingDir/...
+	out_generatorSettings.addToProcessDirectory(workingDirectory);
+
+	//Ignore generated files...
+	out_generatorSettings.addIgnoredDirectory(workingDirectory / "Libs");
+	out_generatorSettings.addIgnoredDirectory(workingDirectory / "Generated");
+
+	//Only parse .hpp files
+	out_generatorSettings.addSupportedFileExtension(".hpp");
+}
+
+inline bool initParsingSettings(kodgen::ParsingSettings& parsingSettings)
+{
+	
+	//We abort parsing if we encounter a single error while parsing
+	parsingSettings.shouldAbortParsingOnFirstError = true;
+
+	//Each property will be separed by a ,
+	parsingSettings.propertyParsingSettings.propertySeparator = ',';
+
+	//Subproperties are surrounded by []
+	parsingSettings.propertyParsingSettings.argumentEnclosers[0] = '[';
+	parsingSettings.propertyParsingSettings.argumentEnclosers[1] = ']';
+
+	//Each subproperty will be separed by a ,
+	parsingSettings.propertyParsingSettings.argumentSeparator = ',';
+
+	//Define the macros to use for each entity type
+	parsingSettings.propertyParsingSettings.namespaceMacroName	= "DNamespace";
+	parsingSettings.propertyParsingSettings.classMacroName		= "DClass";
+	parsingSettings.propertyParsingSettings.structMacroName		= "DStruct";
+	parsingSettings.propertyParsingSettings.fieldMacroName		= "DVariable";
+	parsingSettings.propertyParsingSettings.fieldMacroName		= "DField";
+	parsingSettings.propertyParsingSettings.functionMacroName	= "DFunction";
+	parsingSettings.propertyParsingSettings.methodMacroName		= "DMethod";
+	parsingSettings.propertyParsingSettings.enumMacroName		= "DEnum";
+	parsingSettings.propertyParsingSettings.enumValueMacroName	= "DEnumVal";
+
+	parsingSettings.shouldParseAllNamespaces = true;
+	parsingSettings.shouldParseAllEnumValues = true;
+	
+	parsingSettings.shouldLogDiagnostic = false;
+
+	//No parse timeout by default, it can be enabled with --parse-timeout=<seconds>
+	parsingSettings.parseTimeout = 0.0f;
+
+	parsingSettings.cppVersion = kodgen::ECppVersion::Cpp20;
+
+	//This is setup that way for CI tools only
+	//In reality, the compiler used by the user machine running the generator should be set.
+	//It has nothing to see with the compiler used to compile the generator.
+//#if defined(__GNUC__)
+//	return parsingSettings.setCompilerExeName("g++");
+//#elif defined(__clang__)
+	return parsingSettings.setCompilerExeName("clang++");
+//#elif defined(_MSC_VER)
+//	return parsingSettings.setCompilerExeName("msvc");
+//#else
+//	return false;	//Unsupported compiler
+//#endif
+}
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <string>
 
 #include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
+#include "Kodgen/CodeGen/CodeWriter.h"
 
 #include "Utils.hpp"
 
@@ -20,6 +21,11 @@ public:
 		kodgen::MacroPropertyCodeGen("Get", kodgen::EEntityType::Field)
 	{}
 
+	virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+	{
+		return kodgen::ECodeGenLocationMask::ClassFooter | kodgen::ECodeGenLocationMask::SourceFileHeader;
+	}
+
 	virtual bool preGenerateCodeForEntity(kodgen::EntityInfo const& /* entity */, kodgen::Property const& property, kodgen::uint8 /* propertyIndex */, kodgen::MacroCodeGenEnv& env) noexcept override
 	{
 		std::string errorMessage;
@@ -142,12 +148,14 @@ public:
 			returnName.insert(0, "&");
 		}
 
-		inout_result += "public: " + env.getSeparator();
+		kodgen::CodeWriter writer(inout_result, env.getSeparator());
+
+		writer.writeLine("public: ");
 		if (isInline)
-			inout_result += preTypeQualifiers + rawReturnType + " " + methodName + postQualifiers + " { return " + returnName + "; }" + env.getSeparator();
+			writer.writeLine("{}{} {}{} { return {}; }", preTypeQualifiers, rawReturnType, methodName, postQualifiers, returnName);
 
 		else
-			inout_result += preTypeQualifiers + rawReturnType + " " + methodName + postQualifiers + ";" + env.getSeparator();
+			writer.writeLine("{}{} {}{};", preTypeQualifiers, rawReturnType, methodName, postQualifiers);
 
 		return true;
 	}
@@ -232,7 +240,8 @@ public:
 			returnName.insert(0, "&");
 		}
 
-		inout_result += rawReturnType + " " + entity.outerEntity->getFullName() + "::" + methodName + postQualifiers + " { return " + returnName + "; }" + env.getSeparator();
+		kodgen::CodeWriter(inout_result, env.getSeparator())
+			.writeLine("{} {}::{}{} { return {}; }", rawReturnType, entity.outerEntity->getFullName(), methodName, postQualifiers, returnName);
 
 		return true;
 	}
@@ -9,6 +9,11 @@
 #include "ReflectionEnumCodeGen.h"
 #include "ResourcePropertyCodeGen.h"
 #include "RegistrationBaseCodeGen.h"
+#include "StaticReflectionCodeGen.h"
+#include "BinarySerializationCodeGen.h"
+#include "SoACodeGen.h"
+#include "GpuPackedCodeGen.h"
+#include "ResourceRefOffsetsCodeGen.h"
 
 class GetSetCGM : public kodgen::MacroCodeGenModule
 {
@@ -21,6 +26,14 @@ class GetSetCGM : public kodgen::MacroCodeGenModule
 		ResourcePropertyCodeGen _resourcePropertyCodeGen;
 		RegistrationClassCodeGen _registrationClassCodeGen;
 		RegistrationStructCodeGen _registrationStructCodeGen;
+		StaticReflectionCodeGen _staticReflectionCodeGen;
+		BinarySerializationCodeGen _binarySerializationCodeGen;
+		SoACodeGen _soaCodeGen;
+		GpuPackedCodeGen _gpuPackedCodeGen;
+		ResourceRefOffsetsCodeGen _resourceRefOffsetsCodeGen;
+
+		bool _staticReflectionEnabled = false;
+		bool _lazyRegistrationEnabled = false;
 
 	public:
 		GetSetCGM() noexcept
@@ -33,15 +46,67 @@ class GetSetCGM : public kodgen::MacroCodeGenModule
 			addPropertyCodeGen(_resourcePropertyCodeGen);
 			addPropertyCodeGen(_registrationClassCodeGen);
 			addPropertyCodeGen(_registrationStructCodeGen);
+			addPropertyCodeGen(_binarySerializationCodeGen);
+			addPropertyCodeGen(_soaCodeGen);
+			addPropertyCodeGen(_gpuPackedCodeGen);
+			addPropertyCodeGen(_resourceRefOffsetsCodeGen);
 		}
 
-		GetSetCGM(GetSetCGM const&):
+		GetSetCGM(GetSetCGM const& other):
 			GetSetCGM() //Call the default constructor to add the copied instance its own property references
 		{
+			if (other._staticReflectionEnabled)
+				enableStaticReflection();
+
+			if (other._lazyRegistrationEnabled)
+				enableLazyRegistration();
+		}
+
+		// Also generate constexpr field descriptors and a ForEachField visitor for Serialize classes and structs
+		void enableStaticReflection() noexcept
+		{
+			if (!_staticReflectionEnabled)
+			{
+				addPropertyCodeGen(_staticReflectionCodeGen);
+				_staticReflectionEnabled = true;
+			}
+		}
+
+		// Register reflected types with RTTR on first lookup instead of at static initialization
+		void enableLazyRegistration() noexcept
+		{
+			_lazyRegistrationEnabled = true;
+
+			_reflectionClassCodeGen.setLazyRegistration(true);
+			_reflectionStructCodeGen.setLazyRegistration(true);
+			_reflectionEnumCodeGen.setLazyRegistration(true);
+		}
+
+		virtual bool initialGenerateSourceFileHeaderCode(kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept override
+		{
+			if (_lazyRegistrationEnabled)
+			{
+				kodgen::CodeWriter writer(inout_result, env.getSeparator(), 4096u);
+				WriteLazyRegistrationRuntime(writer);
+			}
+
+			return true;
 		}
 
 		virtual GetSetCGM* clone() const noexcept override
 		{
 			return new GetSetCGM(*this);
 		}
+
+		virtual kodgen::EParsedData getRequiredParsedData() const noexcept override
+		{
+			//Entity ids are never read by the Darius generators
+			return kodgen::EParsedData::CanonicalTypeName | kodgen::EParsedData::TypeLayout;
+		}
+
+		virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+		{
+			//All the code is generated by the property code generators
+			return kodgen::ECodeGenLocationMask::None;
+		}
 };
\ No newline at end of file
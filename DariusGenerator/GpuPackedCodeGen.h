@@ -0,0 +1,406 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
+#include "Kodgen/CodeGen/CodeWriter.h"
+
+#include "Utils.hpp"
+
+// Generates Darius::Reflection::GpuPacked<T> for DStruct(GpuPacked[hlsl|std140]): a mirror of the struct laid out
+// with the HLSL constant buffer (default) or GLSL std140 packing rules, with static_asserts on its size and offsets,
+// and a Pack function writing an array of structs to a mapped buffer.
+// Supported fields are float / int / unsigned int / double / bool scalars, POD structs of 2 to 4 floats or ints (vectors),
+// POD structs of 16 floats (4x4 matrices), and C arrays of them.
+class GpuPackedCodeGen : public kodgen::MacroPropertyCodeGen
+{
+	enum class EPacking
+	{
+		Hlsl,
+		Std140
+	};
+
+	struct GpuField
+	{
+		kodgen::FieldInfo const*	field;
+		std::string					elementType;			// Element type in the mirror
+		std::size_t					cpuElementSize = 0u;
+		std::size_t					gpuElementSize = 0u;	// Bytes written for a single element
+		std::size_t					scalarSize = 4u;
+		std::size_t					components = 1u;		// Components of a vector, 0 for a matrix
+		std::size_t					rows = 0u;				// 16-byte rows of a matrix
+		std::size_t					count = 0u;				// Elements of an array, 0 if not an array
+		bool						isBool = false;
+
+		std::size_t					offset = 0u;
+		std::size_t					stride = 0u;
+		std::size_t					size = 0u;
+	};
+
+	static std::size_t RoundUp(std::size_t value, std::size_t alignment)
+	{
+		return (value + alignment - 1u) / alignment * alignment;
+	}
+
+	static bool GetPacking(kodgen::Property const& property, EPacking& out_packing)
+	{
+		if (property.arguments.empty() || (property.arguments.size() == 1u && property.arguments[0] == "hlsl"))
+			out_packing = EPacking::Hlsl;
+		else if (property.arguments.size() == 1u && property.arguments[0] == "std140")
+			out_packing = EPacking::Std140;
+		else
+			return false;
+
+		return true;
+	}
+
+	static bool ClassifyField(kodgen::FieldInfo const& field, GpuField& out_field, std::string& out_error)
+	{
+		out_field.field = &field;
+
+		// Arrays are flattened, whatever their dimension
+		std::size_t count = 1u;
+		for (auto const& part : field.type.typeParts)
+		{
+			if ((part.descriptor & kodgen::ETypeDescriptor::CArray) != kodgen::ETypeDescriptor::Undefined)
+			{
+				count *= part.additionalData;
+				out_field.count = count;
+			}
+			else if ((part.descriptor & (kodgen::ETypeDescriptor::Ptr | kodgen::ETypeDescriptor::LRef | kodgen::ETypeDescriptor::RRef)) != kodgen::ETypeDescriptor::Undefined)
+			{
+				out_error = "pointers and references can't be uploaded to the GPU";
+				return false;
+			}
+		}
+
+		if (field.type.sizeInBytes == 0u || count == 0u)
+		{
+			out_error = "its size is unknown";
+			return false;
+		}
+
+		std::string elementType = field.type.getCanonicalName();
+		elementType = elementType.substr(0u, elementType.find('['));
+		while (!elementType.empty() && elementType.back() == ' ')
+			elementType.pop_back();
+
+		out_field.cpuElementSize = field.type.sizeInBytes / count;
+
+		if (elementType == "bool")
+		{
+			out_field.isBool = true;
+			out_field.elementType = "std::uint32_t";
+			out_field.gpuElementSize = 4u;
+		}
+		else if (elementType == "float" || elementType == "int" || elementType == "unsigned int" || elementType == "double")
+		{
+			out_field.elementType = elementType;
+			out_field.gpuElementSize = out_field.cpuElementSize;
+			out_field.scalarSize = out_field.cpuElementSize;
+		}
+		else if (field.type.isPOD && (out_field.cpuElementSize == 8u || out_field.cpuElementSize == 12u || out_field.cpuElementSize == 16u))
+		{
+			out_field.elementType = elementType;
+			out_field.gpuElementSize = out_field.cpuElementSize;
+			out_field.components = out_field.cpuElementSize / 4u;
+		}
+		else if (field.type.isPOD && out_field.cpuElementSize == 64u)
+		{
+			out_field.elementType = elementType;
+			out_field.gpuElementSize = 64u;
+			out_field.components = 0u;
+			out_field.rows = 4u;
+		}
+		else
+		{
+			out_error = "type " + elementType + " has no GPU equivalent";
+			return false;
+		}
+
+		return true;
+	}
+
+	// Fill the offset, stride and size of each field, return the size of the packed struct
+	static std::size_t ComputeLayout(std::vector<GpuField>& fields, EPacking packing)
+	{
+		std::size_t offset = 0u;
+
+		for (GpuField& gpuField : fields)
+		{
+			if (packing == EPacking::Hlsl)
+			{
+				if (gpuField.count != 0u || gpuField.rows != 0u)
+				{
+					// Arrays elements and matrices start on a new register, the last array element is not padded
+					offset = RoundUp(offset, 16u);
+					gpuField.stride = RoundUp(gpuField.gpuElementSize, 16u);
+					gpuField.size = (gpuField.count != 0u) ? (gpuField.count - 1u) * gpuField.stride + gpuField.gpuElementSize : gpuField.gpuElementSize;
+				}
+				else
+				{
+					// Scalars and vectors can't straddle a 16 bytes register
+					offset = RoundUp(offset, gpuField.scalarSize);
+					if (offset % 16u + gpuField.gpuElementSize > 16u)
+						offset = RoundUp(offset, 16u);
+					gpuField.size = gpuField.gpuElementSize;
+				}
+			}
+			else
+			{
+				// Base alignment: N for scalars, 2N for 2 components vectors, 4N for 3 and 4 components vectors, vec4 for matrices
+				std::size_t alignment = (gpuField.rows != 0u) ? 16u : (gpuField.components == 1u) ? gpuField.scalarSize : (gpuField.components == 2u) ? 2u * gpuField.scalarSize : 4u * gpuField.scalarSize;
+
+				if (gpuField.count != 0u)
+				{
+					// Array elements are rounded up to vec4 alignment
+					offset = RoundUp(offset, RoundUp(alignment, 16u));
+					gpuField.stride = RoundUp(gpuField.gpuElementSize, 16u);
+					gpuField.size = gpuField.count * gpuField.stride;
+				}
+				else
+				{
+					offset = RoundUp(offset, alignment);
+					gpuField.size = gpuField.gpuElementSize;
+				}
+			}
+
+			gpuField.offset = offset;
+			offset += gpuField.size;
+		}
+
+		return RoundUp(offset, 16u);
+	}
+
+	static bool IsCopiedVerbatim(GpuField const& gpuField)
+	{
+		return !gpuField.isBool && gpuField.cpuElementSize == gpuField.gpuElementSize && (gpuField.count == 0u || gpuField.stride == gpuField.gpuElementSize);
+	}
+
+public:
+	GpuPackedCodeGen() noexcept :
+		kodgen::MacroPropertyCodeGen("GpuPacked", kodgen::EEntityType::Struct)
+	{}
+
+	virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+	{
+		return kodgen::ECodeGenLocationMask::HeaderFileFooter;
+	}
+
+	virtual bool preGenerateCodeForEntity(kodgen::EntityInfo const& /* entity */, kodgen::Property const& property, kodgen::uint8 /* propertyIndex */, kodgen::MacroCodeGenEnv& env) noexcept override
+	{
+		EPacking packing;
+
+		if (!GetPacking(property, packing))
+		{
+			if (env.getLogger() != nullptr)
+				env.getLogger()->log("GpuPacked property only accepts a single 'hlsl' or 'std140' argument.", kodgen::ILogger::ELogSeverity::Error);
+
+			return false;
+		}
+
+		return true;
+	}
+
+	virtual bool initialGenerateHeaderFileHeaderCode(kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept override
+	{
+		if (!IsPropertyUsedInFile(*this, env))
+			return true;
+
+		// Shared by all generated headers, so guarded
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 1024u);
+
+		writer.writeLine("#ifndef D_GPU_PACKING");
+		writer.writeLine("#define D_GPU_PACKING");
+		writer.writeLine("#include <cstddef>");
+		writer.writeLine("#include <cstdint>");
+		writer.writeLine("#include <cstring>");
+		writer.writeLine("#include <new>");
+		writer.writeLine("#include <span>");
+		writer.writeLine("namespace Darius::Reflection");
+		writer.writeLine("{");
+		writer.writeLine("\tenum class EGpuPacking { Hlsl, Std140 };");
+		writer.writeLine("\ttemplate<typename T> struct GpuPacked;");
+		writer.writeLine("\ttemplate<std::size_t Size> struct GpuBytes { std::byte Bytes[Size]; };");
+		writer.writeLine("\ttemplate<typename T, std::size_t Count, std::size_t Stride, std::size_t Size>");
+		writer.writeLine("\tstruct GpuArray");
+		writer.writeLine("\t{");
+		writer.writeLine("\t\talignas(T) std::byte Bytes[Size];");
+		writer.writeLine("\t\tT& operator[](std::size_t index) noexcept { return *std::launder(reinterpret_cast<T*>(Bytes + index * Stride)); }");
+		writer.writeLine("\t\tT const& operator[](std::size_t index) const noexcept { return *std::launder(reinterpret_cast<T const*>(Bytes + index * Stride)); }");
+		writer.writeLine("\t\tstatic constexpr std::size_t size() noexcept { return Count; }");
+		writer.writeLine("\t};");
+		writer.writeLine("}");
+		writer.writeLine("#endif");
+
+		return true;
+	}
+
+	virtual bool generateHeaderFileFooterCodeForEntity(kodgen::EntityInfo const& entity,
+		kodgen::Property const& property,
+		std::uint8_t			/* propertyIndex */,
+		kodgen::MacroCodeGenEnv& env,
+		std::string& inout_result) noexcept override
+	{
+		kodgen::StructClassInfo const& clazz = reinterpret_cast<kodgen::StructClassInfo const&>(entity);
+
+		EPacking packing = EPacking::Hlsl;
+		GetPacking(property, packing);
+
+		std::vector<GpuField> fields;
+		bool success = true;
+
+		for (auto const& field : clazz.fields)
+		{
+			if (field.isStatic)
+				continue;
+
+			GpuField gpuField;
+			std::string error;
+
+			if (!ClassifyField(field, gpuField, error))
+			{
+				if (env.getLogger() != nullptr)
+					env.getLogger()->log("Can't generate the GPU packed layout of " + clazz.getFullName() + ": field " + field.name + " " + error, kodgen::ILogger::ELogSeverity::Error);
+
+				success = false;
+				continue;
+			}
+
+			fields.push_back(std::move(gpuField));
+		}
+
+		if (!success)
+			return false;
+
+		std::size_t const packedSize = ComputeLayout(fields, packing);
+		std::string const structFullName = clazz.getFullName();
+		std::string const mirrorName = "Darius::Reflection::GpuPacked<" + structFullName + ">";
+
+		// Fields copied with a single memcpy: verbatim fields contiguous both in the struct and in the packed layout
+		std::vector<std::vector<GpuField const*>> runs;
+		for (GpuField const& gpuField : fields)
+		{
+			if (IsCopiedVerbatim(gpuField) && !runs.empty() && IsCopiedVerbatim(*runs.back().front()))
+			{
+				GpuField const& last = *runs.back().back();
+
+				if (last.offset + last.size == gpuField.offset &&
+					last.field->memoryOffset + static_cast<kodgen::int64>(last.field->type.sizeInBytes) == gpuField.field->memoryOffset &&
+					gpuField.offset - runs.back().front()->offset == static_cast<std::size_t>(gpuField.field->memoryOffset - runs.back().front()->field->memoryOffset))
+				{
+					runs.back().push_back(&gpuField);
+					continue;
+				}
+			}
+
+			runs.push_back({ &gpuField });
+		}
+
+		// The whole struct is a single run matching the packed layout, so arrays of structs are copied at once
+		bool const isLayoutIdentical = runs.size() == 1u && IsCopiedVerbatim(*runs.front().front()) && fields.front().offset == 0u &&
+			fields.front().field->memoryOffset == 0 && clazz.type.sizeInBytes == packedSize;
+
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 1024u + fields.size() * 384u);
+
+		writer.writeLine("template<>");
+		writer.writeLine("struct alignas(16) {}", mirrorName);
+		writer.writeLine("{");
+		writer.writeLine("\tusing ValueType = {};", structFullName);
+		writer.writeLine("\tstatic constexpr ::Darius::Reflection::EGpuPacking Packing = ::Darius::Reflection::EGpuPacking::{};", packing == EPacking::Hlsl ? "Hlsl" : "Std140");
+		writer.writeLine("\tstatic constexpr bool IsLayoutIdentical = {};", isLayoutIdentical ? "true" : "false");
+
+		// Mirror fields, with explicit padding so that the mirror can be inspected and copied as is
+		std::size_t mirrorOffset = 0u;
+		std::size_t paddingIndex = 0u;
+
+		auto writePadding = [&writer, &mirrorOffset, &paddingIndex](std::size_t offset)
+			{
+				if (offset > mirrorOffset)
+					writer.writeLine("\tstd::byte GpuPadding{}[{}];", paddingIndex++, offset - mirrorOffset);
+				mirrorOffset = offset;
+			};
+
+		for (GpuField const& gpuField : fields)
+		{
+			writePadding(gpuField.offset);
+
+			if (gpuField.count != 0u)
+				writer.writeLine("\t::Darius::Reflection::GpuArray<{}, {}, {}, {}> {};", gpuField.elementType, gpuField.count, gpuField.stride, gpuField.size, gpuField.field->name);
+			else if (!gpuField.isBool && gpuField.field->type.alignment != 0u && gpuField.offset % gpuField.field->type.alignment != 0u)
+				writer.writeLine("\t::Darius::Reflection::GpuBytes<{}> {};", gpuField.size, gpuField.field->name);
+			else
+				writer.writeLine("\t{} {};", gpuField.elementType, gpuField.field->name);
+
+			mirrorOffset += gpuField.size;
+		}
+		writePadding(packedSize);
+
+		// Pack values into dst, which must have room for values.size() * sizeof(GpuPacked) bytes. Padding bytes are left untouched
+		writer.writeLine("\tstatic void Pack(std::span<ValueType const> values, void* dst) noexcept");
+		writer.writeLine("\t{");
+
+		if (isLayoutIdentical)
+		{
+			writer.writeLine("\t\tstd::memcpy(dst, values.data(), values.size_bytes());");
+		}
+		else
+		{
+			writer.writeLine("\t\tstd::byte* out = static_cast<std::byte*>(dst);");
+			writer.writeLine("\t\tfor (ValueType const& value : values)");
+			writer.writeLine("\t\t{");
+
+			for (auto const& run : runs)
+			{
+				GpuField const& first = *run.front();
+
+				if (IsCopiedVerbatim(first))
+				{
+					std::size_t const runSize = run.back()->offset + run.back()->size - first.offset;
+					writer.writeLine("\t\t\tstd::memcpy(out + {}, &value.{}, {});", first.offset, first.field->name, runSize);
+				}
+				else if (first.count != 0u)
+				{
+					writer.write("\t\t\tfor (std::size_t i = 0u; i < {}u; i++) ", first.count);
+
+					if (first.isBool)
+						writer.write("{ std::uint32_t const word = reinterpret_cast<bool const*>(&value.{})[i] ? 1u : 0u; std::memcpy(out + {} + i * {}, &word, 4); }", first.field->name, first.offset, first.stride);
+					else
+						writer.write("std::memcpy(out + {} + i * {}, reinterpret_cast<std::byte const*>(&value.{}) + i * {}, {});", first.offset, first.stride, first.field->name, first.cpuElementSize, first.gpuElementSize);
+
+					writer.endLine();
+				}
+				else
+				{
+					writer.writeLine("\t\t\t{ std::uint32_t const word = value.{} ? 1u : 0u; std::memcpy(out + {}, &word, 4); }", first.field->name, first.offset);
+				}
+			}
+
+			writer.writeLine("\t\t\tout += {};", packedSize);
+			writer.writeLine("\t\t}");
+		}
+
+		writer.writeLine("\t}");
+		writer.writeLine("\tstatic GpuPacked FromValue(ValueType const& value) noexcept { GpuPacked result { }; Pack({ &value, 1u }, &result); return result; }");
+		writer.writeLine("};");
+
+		// Checks of the generated layout, and of the field types classification against the compiled struct
+		writer.writeLine("static_assert(sizeof({}) == {}, \"GPU packed size of {} is wrong\");", mirrorName, packedSize, structFullName);
+		for (GpuField const& gpuField : fields)
+		{
+			writer.writeLine("static_assert(offsetof({}, {}) == {}, \"GPU packed offset of {}::{} is wrong\");", mirrorName, gpuField.field->name, gpuField.offset, structFullName, gpuField.field->name);
+			writer.writeLine("static_assert(sizeof({}::{}) == {}, \"Layout of {}::{} changed since code generation\");", structFullName, gpuField.field->name, gpuField.field->type.sizeInBytes, structFullName, gpuField.field->name);
+		}
+		for (auto const& run : runs)
+		{
+			if (run.size() > 1u)
+				writer.writeLine("static_assert(offsetof({}, {}) - offsetof({}, {}) == {}, \"Layout of {} changed since code generation\");",
+					structFullName, run.back()->field->name, structFullName, run.front()->field->name, run.back()->offset - run.front()->offset, structFullName);
+		}
+		if (isLayoutIdentical)
+			writer.writeLine("static_assert(sizeof({}) == {}, \"Layout of {} changed since code generation\");", structFullName, packedSize, structFullName);
+
+		return true;
+	}
+};
\ No newline at end of file
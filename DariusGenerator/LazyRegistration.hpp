@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+
+#include "Kodgen/CodeGen/CodeWriter.h"
+
+#include "Utils.hpp"
+
+// Runtime of the lazy RTTR registration: every reflected type links a LazyRegistration node at static initialization
+// (two pointer writes) instead of running its whole RTTR registration before main.
+// Written once per generated source file, guarded for unity builds.
+void WriteLazyRegistrationRuntime(kodgen::CodeWriter& writer)
+{
+	writer.writeLine("#ifndef D_LAZY_REGISTRATION");
+	writer.writeLine("#define D_LAZY_REGISTRATION");
+	writer.writeLine("#include <algorithm>");
+	writer.writeLine("#include <cstdint>");
+	writer.writeLine("#include <mutex>");
+	writer.writeLine("#include <string_view>");
+	writer.writeLine("#include <vector>");
+	writer.writeLine("namespace Darius::Reflection");
+	writer.writeLine("{");
+	writer.writeLine("\tclass LazyRegistration");
+	writer.writeLine("\t{");
+	writer.writeLine("\tpublic:");
+	writer.writeLine("\t\tLazyRegistration(std::uint64_t typeId, std::string_view typeName, void (*registerType)()) noexcept :");
+	writer.writeLine("\t\t\tmTypeId(typeId), mTypeName(typeName), mRegisterType(registerType), mNext(GetHead())");
+	writer.writeLine("\t\t{ GetHead() = this; }");
+	writer.writeLine("\t\tstd::uint64_t GetTypeId() const noexcept { return mTypeId; }");
+	writer.writeLine("\t\tstd::string_view GetTypeName() const noexcept { return mTypeName; }");
+	writer.writeLine("\t\tvoid EnsureRegistered() { std::call_once(mOnce, mRegisterType); }");
+	writer.writeLine("\t\t// Register the type with the given id if not already done, return false if the type is unknown");
+	writer.writeLine("\t\tstatic bool EnsureRegistered(std::uint64_t typeId) { return Find(typeId) != nullptr; }");
+	writer.writeLine("\t\t// Register all the types accepted by predicate(LazyRegistration const&), i.e. the namespace of a subsystem");
+	writer.writeLine("\t\ttemplate<typename Predicate>");
+	writer.writeLine("\t\tstatic void EnsureRegisteredIf(Predicate&& predicate)");
+	writer.writeLine("\t\t{");
+	writer.writeLine("\t\t\tfor (LazyRegistration* it = GetHead(); it != nullptr; it = it->mNext)");
+	writer.writeLine("\t\t\t\tif (predicate(static_cast<LazyRegistration const&>(*it))) it->EnsureRegistered();");
+	writer.writeLine("\t\t}");
+	writer.writeLine("\t\t// Find the type with the given id and register it if not already done, nullptr if the type is unknown");
+	writer.writeLine("\t\tstatic LazyRegistration* Find(std::uint64_t typeId)");
+	writer.writeLine("\t\t{");
+	writer.writeLine("\t\t\tLazyRegistration* registration = FindUnregistered(typeId);");
+	writer.writeLine("\t\t\tif (registration != nullptr) registration->EnsureRegistered();");
+	writer.writeLine("\t\t\treturn registration;");
+	writer.writeLine("\t\t}");
+	writer.writeLine("\tprivate:");
+	writer.writeLine("\t\t// The lookup index is built on the first call, once all the statically linked types are known");
+	writer.writeLine("\t\tstatic LazyRegistration* FindUnregistered(std::uint64_t typeId)");
+	writer.writeLine("\t\t{");
+	writer.writeLine("\t\t\tstatic std::vector<LazyRegistration*> const index = []()");
+	writer.writeLine("\t\t\t{");
+	writer.writeLine("\t\t\t\tstd::vector<LazyRegistration*> result;");
+	writer.writeLine("\t\t\t\tfor (LazyRegistration* it = GetHead(); it != nullptr; it = it->mNext) result.push_back(it);");
+	writer.writeLine("\t\t\t\tstd::sort(result.begin(), result.end(), [](LazyRegistration const* lhs, LazyRegistration const* rhs) { return lhs->mTypeId < rhs->mTypeId; });");
+	writer.writeLine("\t\t\t\treturn result;");
+	writer.writeLine("\t\t\t}();");
+	writer.writeLine("\t\t\tauto it = std::lower_bound(index.begin(), index.end(), typeId, [](LazyRegistration const* lhs, std::uint64_t id) { return lhs->mTypeId < id; });");
+	writer.writeLine("\t\t\treturn (it != index.end() && (*it)->mTypeId == typeId) ? *it : nullptr;");
+	writer.writeLine("\t\t}");
+	writer.writeLine("\t\tstatic LazyRegistration*& GetHead() noexcept { static LazyRegistration* head = nullptr; return head; }");
+	writer.writeLine("\t\tstd::uint64_t mTypeId;");
+	writer.writeLine("\t\tstd::string_view mTypeName;");
+	writer.writeLine("\t\tvoid (*mRegisterType)();");
+	writer.writeLine("\t\tLazyRegistration* mNext;");
+	writer.writeLine("\t\tstd::once_flag mOnce;");
+	writer.writeLine("\t};");
+	writer.writeLine("}");
+	writer.writeLine("#endif");
+}
+
+// Replaces RTTR_REGISTRATION_PFX(name): the registration function is the same (so RTTR_REGISTRATION_FRIEND_PFX still grants access)
+// but is only called through the LazyRegistration node keyed by the stable id of the type. The caller writes the function body.
+void WriteLazyRegistrationPrologue(kodgen::CodeWriter& writer, std::string const& name, std::string const& fullName)
+{
+	writer.write("static void rttr_auto_register_reflection_function_{}_();\n", name);
+	writer.write("static ::Darius::Reflection::LazyRegistration darius_lazy_registration_{}_(0x{}ull, \"{}\", &rttr_auto_register_reflection_function_{}_);\n",
+		name, ToHexString(Fnv1a64(fullName)), fullName, name);
+	writer.write("static void rttr_auto_register_reflection_function_{}_()\n", name);
+}
\ No newline at end of file
@@ -3,11 +3,14 @@
 #include <string>
 
 #include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
+#include "Kodgen/CodeGen/CodeWriter.h"
 
 #include "Utils.hpp"
+#include "LazyRegistration.hpp"
 
 class ReflectionBaseCodeGen : public kodgen::MacroPropertyCodeGen
 {
+	bool _lazyRegistration = false;
 
 public:
 	ReflectionBaseCodeGen(kodgen::EEntityType entityType) noexcept :
@@ -19,6 +22,17 @@ public:
 		return -1;
 	}
 
+	// Register the types on first lookup through Darius::Reflection::LazyRegistration instead of at static initialization
+	void setLazyRegistration(bool lazyRegistration) noexcept
+	{
+		_lazyRegistration = lazyRegistration;
+	}
+
+	virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+	{
+		return kodgen::ECodeGenLocationMask::HeaderFileHeader | kodgen::ECodeGenLocationMask::ClassFooter | kodgen::ECodeGenLocationMask::SourceFileHeader;
+	}
+
 	virtual bool preGenerateCodeForEntity(kodgen::EntityInfo const& entity, kodgen::Property const& property, std::uint8_t propertyIndex, kodgen::MacroCodeGenEnv& env) noexcept override
 	{
 		kodgen::StructClassInfo const& safeClass = reinterpret_cast<kodgen::StructClassInfo const&>(entity);
@@ -52,7 +66,7 @@ public:
 		kodgen::Property const& prop, kodgen::uint8 propertyIndex, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept override
 	{
 		kodgen::StructClassInfo const& safeClass = reinterpret_cast<kodgen::StructClassInfo const&>(entity);
-		inout_result += "static void rttr_auto_register_reflection_function_" + safeClass.name + "_(); " + env.getSeparator();
+		kodgen::CodeWriter(inout_result, env.getSeparator()).writeLine("static void rttr_auto_register_reflection_function_{}_(); ", safeClass.name);
 
 		return true;
 	}
@@ -65,20 +79,24 @@ public:
 	{
 		kodgen::StructClassInfo const& clazz = reinterpret_cast<kodgen::StructClassInfo const&>(entity);
 
-		inout_result += "RTTR_REGISTRATION_FRIEND_PFX(" + clazz.name + ") " + env.getSeparator();
-		inout_result += "RTTR_ENABLE(";
+		kodgen::CodeWriter writer(inout_result, env.getSeparator());
+
+		// Stable id of the type, also used as the key of its lazy registration.
+		// Written first as RTTR_ENABLE ends with private:, which the members following the footer rely on
+		writer.writeLine("public: ");
+		writer.writeLine("static constexpr std::uint64_t StaticTypeId = 0x{}ull; ", ToHexString(Fnv1a64(clazz.getFullName())));
+
+		writer.writeLine("RTTR_REGISTRATION_FRIEND_PFX({}) ", clazz.name);
+		writer.write("RTTR_ENABLE(");
 
 		bool firstParent = true;
 
 		for (auto const& parent : clazz.parents)
 		{
-			if (!firstParent)
-				inout_result += ", ";
-
+			writer.write(firstParent ? "{}" : ", {}", parent.type.getCanonicalName());
 			firstParent = false;
-			inout_result += parent.type.getCanonicalName();
 		}
-		inout_result += ") " + env.getSeparator();
+		writer.write(") ").endLine();
 
 		return true;
 	}
@@ -100,14 +118,22 @@ public:
 		if (std::find_if(clazz.properties.begin(), clazz.properties.end(), [](auto const& prop) { return prop.name == "Resource"; }) != clazz.properties.end())
 			isResourceCLass = true;
 
-		inout_result += "#include <rttr/registration.h>\n";
-		inout_result += "RTTR_REGISTRATION_PFX(" + clazz.name + ")\n";
-		inout_result += "{\n";
-		inout_result += "rttr::registration::class_<" + clazz.getFullName() + ">(\"" + clazz.getFullName() + "\")";
+		std::string const classFullName = clazz.getFullName();
+
+		//Each registered property takes roughly a hundred characters
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 256u + (clazz.fields.size() + property.arguments.size()) * 96u);
+
+		writer.write("#include <rttr/registration.h>\n");
+		if (_lazyRegistration)
+			WriteLazyRegistrationPrologue(writer, clazz.name, classFullName);
+		else
+			writer.write("RTTR_REGISTRATION_PFX({})\n", clazz.name);
+		writer.write("{\n");
+		writer.write("rttr::registration::class_<{}>(\"{}\")", classFullName, classFullName);
 
 		if (isResourceCLass)
 		{
-			inout_result += "(rttr::metadata(\"RESOURCE\", true))";
+			writer.write("(rttr::metadata(\"RESOURCE\", true))");
 		}
 
 		// Adding reflection registration for actual fields
@@ -119,37 +145,39 @@ public:
 
 			GetFieldInfo(field, isConst, isSerializable, isAnimatable);
 
-			auto fieldName = field.name[0] == 'm' ? field.name.substr(1, field.name.size() - 1) : field.name;
+			std::string_view fieldName = field.name;
+			if (fieldName[0] == 'm')
+				fieldName.remove_prefix(1u);
 
 			// Checking for const descriptor
 			if (isConst)
-				inout_result += "\n\t.property_readonly(\"" + fieldName + "\", &" + field.getFullName() + ")";
+				writer.write("\n\t.property_readonly(\"{}\", &{})", fieldName, field.getFullName());
 			else
 			{
 
-				inout_result += "\n\t.property(\"" + fieldName + "\", &" + field.getFullName() + ")";
+				writer.write("\n\t.property(\"{}\", &{})", fieldName, field.getFullName());
 
 				if (!isSerializable || isAnimatable)
 				{
 					bool isFirst = true;
 
-					inout_result += "(";
+					writer.write("(");
 
 					// Serializable
 					if (!isSerializable)
 					{
-						inout_result += "\n\t\trttr::metadata(\"NO_SERIALIZE\", true)";
+						writer.write("\n\t\trttr::metadata(\"NO_SERIALIZE\", true)");
 						isFirst = false;
 					}
 					if (isAnimatable)
 					{
 						if (!isFirst)
-							inout_result += ",";
-						inout_result += "\n\t\trttr::metadata(\"ANIMATE\", true)";
+							writer.write(",");
+						writer.write("\n\t\trttr::metadata(\"ANIMATE\", true)");
 						isFirst = false;
 					}
 
-					inout_result += ")";
+					writer.write(")");
 				}
 			}
 		}
@@ -176,44 +204,42 @@ public:
 				offset++;
 			}
 
-			std::string propName = arg.substr(offset, arg.size() - offset);
+			std::string_view propName = std::string_view(arg).substr(offset);
 
-			inout_result += "\n\t.property(\"" + propName + "\", &" + clazz.getFullName();
-			inout_result += isBoolean ? "::Is" : "::Get";
-			inout_result += propName + ", &" + clazz.getFullName() + "::Set" + propName + ")";
+			writer.write("\n\t.property(\"{}\", &{}{}{}, &{}::Set{})", propName, classFullName, isBoolean ? "::Is" : "::Get", propName, classFullName, propName);
 
 			if (!isSerializable || isAnimatable)
 			{
 				bool firstMeta = true;
-				inout_result += "(";
+				writer.write("(");
 
 				// Serializable
 				if (!isSerializable)
 				{
-					inout_result += "\n\t\trttr::metadata(\"NO_SERIALIZE\", true)";
+					writer.write("\n\t\trttr::metadata(\"NO_SERIALIZE\", true)");
 					firstMeta = false;
 				}
 				if (isAnimatable)
 				{
 					if (!firstMeta)
-						inout_result += ",";
-					inout_result += "\n\t\trttr::metadata(\"ANIMATE\", true)";
+						writer.write(",");
+					writer.write("\n\t\trttr::metadata(\"ANIMATE\", true)");
 					firstMeta = false;
 				}
-				inout_result += ")";
+				writer.write(")");
 			}
 		}
 
-		inout_result += ";";
+		writer.write(";");
 
 		if (isResourceCLass)
 		{
-			inout_result += "\nrttr::registration::class_<D_RESOURCE::ResourceRef<" + clazz.getFullName() + ">>(\"D_RESOURCE::ResourceRef<" + clazz.getFullName() + ">\");\n";
+			writer.write("\nrttr::registration::class_<D_RESOURCE::ResourceRef<{}>>(\"D_RESOURCE::ResourceRef<{}>\");\n", classFullName, classFullName);
 
-			inout_result += "rttr::type::register_wrapper_converter_for_base_classes<D_RESOURCE::ResourceRef<" + clazz.getFullName() + ">>();";
+			writer.write("rttr::type::register_wrapper_converter_for_base_classes<D_RESOURCE::ResourceRef<{}>>();", classFullName);
 		}
 
-		inout_result += "\n}\n";
+		writer.write("\n}\n");
 
 		return true;
 	}
@@ -1,13 +1,89 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <algorithm>
 
 #include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
+#include "Kodgen/CodeGen/CodeWriter.h"
 
 #include "Utils.hpp"
+#include "LazyRegistration.hpp"
 
 class ReflectionEnumCodeGen : public kodgen::MacroPropertyCodeGen
 {
+	// Minimal perfect hash of the enum value names (hash and displace):
+	// name i is stored in slot Mix64(Fnv1a64(name) ^ seeds[Mix64(Fnv1a64(name)) % seeds.size()]) % names.size()
+	struct PerfectHash
+	{
+		std::vector<std::uint32_t>	seeds;
+		std::vector<std::size_t>	slotToIndex;
+	};
+
+	static constexpr std::uint32_t MaxPerfectHashSeed = 1u << 16;
+
+	bool _lazyRegistration = false;
+
+	static bool ComputePerfectHash(std::vector<std::string_view> const& names, PerfectHash& out_hash)
+	{
+		std::size_t const count = names.size();
+
+		std::vector<std::uint64_t> hashes;
+		std::vector<std::vector<std::size_t>> buckets(count);
+
+		for (std::size_t i = 0u; i < count; i++)
+		{
+			hashes.push_back(Fnv1a64(names[i]));
+			buckets[Mix64(hashes.back()) % count].push_back(i);
+		}
+
+		// Place the biggest buckets first while most slots are still free
+		std::vector<std::size_t> bucketOrder(count);
+		for (std::size_t i = 0u; i < count; i++)
+			bucketOrder[i] = i;
+		std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&buckets](std::size_t lhs, std::size_t rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+		out_hash.seeds.assign(count, 1u);
+		out_hash.slotToIndex.assign(count, count);
+
+		std::vector<std::size_t> slots;
+
+		for (std::size_t bucketIndex : bucketOrder)
+		{
+			std::vector<std::size_t> const& bucket = buckets[bucketIndex];
+
+			if (bucket.empty())
+				break;
+
+			std::uint32_t seed = 1u;
+			for (; seed < MaxPerfectHashSeed; seed++)
+			{
+				slots.clear();
+
+				for (std::size_t index : bucket)
+				{
+					std::size_t slot = Mix64(hashes[index] ^ seed) % count;
+
+					if (out_hash.slotToIndex[slot] != count || std::find(slots.cbegin(), slots.cend(), slot) != slots.cend())
+						break;
+
+					slots.push_back(slot);
+				}
+
+				if (slots.size() == bucket.size())
+					break;
+			}
+
+			if (seed == MaxPerfectHashSeed)
+				return false;
+
+			out_hash.seeds[bucketIndex] = seed;
+			for (std::size_t i = 0u; i < bucket.size(); i++)
+				out_hash.slotToIndex[slots[i]] = bucket[i];
+		}
+
+		return true;
+	}
 
 public:
 	ReflectionEnumCodeGen() noexcept :
@@ -19,6 +95,166 @@ public:
 		return -1;
 	}
 
+	// Register the enums on first lookup through Darius::Reflection::LazyRegistration instead of at static initialization
+	void setLazyRegistration(bool lazyRegistration) noexcept
+	{
+		_lazyRegistration = lazyRegistration;
+	}
+
+	virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+	{
+		return kodgen::ECodeGenLocationMask::HeaderFileFooter | kodgen::ECodeGenLocationMask::SourceFileHeader;
+	}
+
+	virtual bool initialGenerateHeaderFileHeaderCode(kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept override
+	{
+		if (!IsPropertyUsedInFile(*this, env))
+			return true;
+
+		// Shared by all generated headers, so guarded
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 1024u);
+
+		writer.writeLine("#ifndef D_ENUM_REFLECTION");
+		writer.writeLine("#define D_ENUM_REFLECTION");
+		writer.writeLine("#include <array>");
+		writer.writeLine("#include <cstddef>");
+		writer.writeLine("#include <cstdint>");
+		writer.writeLine("#include <string_view>");
+		writer.writeLine("namespace Darius::Reflection");
+		writer.writeLine("{");
+		writer.writeLine("\ttemplate<typename Enum> struct EnumReflection;");
+		writer.writeLine("\tconstexpr std::uint64_t HashName(std::string_view name) noexcept");
+		writer.writeLine("\t{");
+		writer.writeLine("\t\tstd::uint64_t hash = 14695981039346656037ull;");
+		writer.writeLine("\t\tfor (char c : name) { hash ^= static_cast<std::uint8_t>(c); hash *= 1099511628211ull; }");
+		writer.writeLine("\t\treturn hash;");
+		writer.writeLine("\t}");
+		writer.writeLine("\tconstexpr std::uint64_t MixHash(std::uint64_t hash) noexcept");
+		writer.writeLine("\t{");
+		writer.writeLine("\t\thash ^= hash >> 33; hash *= 0xff51afd7ed558ccdull; hash ^= hash >> 33; hash *= 0xc4ceb9fe1a85ec53ull; hash ^= hash >> 33;");
+		writer.writeLine("\t\treturn hash;");
+		writer.writeLine("\t}");
+		writer.writeLine("\ttemplate<typename Enum> constexpr std::string_view EnumToString(Enum value) noexcept { return EnumReflection<Enum>::ToString(value); }");
+		writer.writeLine("\ttemplate<typename Enum> constexpr bool EnumFromString(std::string_view name, Enum& value) noexcept { return EnumReflection<Enum>::FromString(name, value); }");
+		writer.writeLine("}");
+		writer.writeLine("#endif");
+
+		return true;
+	}
+
+	virtual bool generateHeaderFileFooterCodeForEntity(kodgen::EntityInfo const& entity,
+		kodgen::Property const& /* property */,
+		std::uint8_t			/* propertyIndex */,
+		kodgen::MacroCodeGenEnv& env,
+		std::string& inout_result) noexcept override
+	{
+		kodgen::EnumInfo const& enumInfo = reinterpret_cast<kodgen::EnumInfo const&>(entity);
+
+		if (enumInfo.enumValues.empty())
+			return true;
+
+		std::string const enumFullName = enumInfo.getFullName();
+		std::size_t const count = enumInfo.enumValues.size();
+
+		std::vector<std::string_view> names;
+		for (auto const& enumVal : enumInfo.enumValues)
+			names.push_back(enumVal.name);
+
+		// First declared value of each distinct integer value, sorted by integer value (aliases share a value)
+		std::vector<kodgen::EnumValueInfo const*> distinctValues;
+		for (auto const& enumVal : enumInfo.enumValues)
+			distinctValues.push_back(&enumVal);
+		std::stable_sort(distinctValues.begin(), distinctValues.end(), [](auto lhs, auto rhs) { return lhs->value < rhs->value; });
+		distinctValues.erase(std::unique(distinctValues.begin(), distinctValues.end(), [](auto lhs, auto rhs) { return lhs->value == rhs->value; }), distinctValues.end());
+
+		bool const isContiguous = static_cast<std::uint64_t>(distinctValues.back()->value - distinctValues.front()->value) == distinctValues.size() - 1u;
+
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 1024u + count * 192u);
+
+		writer.writeLine("template<>");
+		writer.writeLine("struct Darius::Reflection::EnumReflection<{}>", enumFullName);
+		writer.writeLine("{");
+		writer.writeLine("\tstatic constexpr std::size_t Count = {};", count);
+		writer.writeLine("\tstatic constexpr std::uint64_t TypeId = 0x{}ull;", ToHexString(Fnv1a64(enumFullName)));
+
+		writer.write("\tstatic constexpr std::array<{}, {}> Values = { ", enumFullName, count);
+		for (std::size_t i = 0u; i < count; i++)
+			writer.write((i == 0u) ? "{}" : ", {}", enumInfo.enumValues[i].getFullName());
+		writer.write(" };").endLine();
+
+		writer.write("\tstatic constexpr std::array<std::string_view, {}> Names = { ", count);
+		for (std::size_t i = 0u; i < count; i++)
+			writer.write((i == 0u) ? "\"{}\"" : ", \"{}\"", names[i]);
+		writer.write(" };").endLine();
+
+		writer.writeLine("\tstatic constexpr bool IsContiguous = {};", isContiguous ? "true" : "false");
+
+		// O(1) lookup by value for contiguous enums, else let the compiler lower the switch
+		writer.writeLine("\tstatic constexpr std::string_view ToString({} value) noexcept", enumFullName);
+		writer.writeLine("\t{");
+
+		if (isContiguous)
+		{
+			writer.write("\t\tconstexpr std::array<std::string_view, {}> namesByValue = { ", distinctValues.size());
+			for (std::size_t i = 0u; i < distinctValues.size(); i++)
+				writer.write((i == 0u) ? "\"{}\"" : ", \"{}\"", distinctValues[i]->name);
+			writer.write(" };").endLine();
+
+			writer.writeLine("\t\tstd::uint64_t const index = static_cast<std::uint64_t>(static_cast<std::int64_t>(value) - ({}ll));", distinctValues.front()->value);
+			writer.writeLine("\t\treturn (index < namesByValue.size()) ? namesByValue[index] : std::string_view();");
+		}
+		else
+		{
+			writer.writeLine("\t\tswitch (value)");
+			writer.writeLine("\t\t{");
+			for (kodgen::EnumValueInfo const* enumVal : distinctValues)
+				writer.writeLine("\t\t\tcase {}: return \"{}\";", enumVal->getFullName(), enumVal->name);
+			writer.writeLine("\t\t\tdefault: return std::string_view();");
+			writer.writeLine("\t\t}");
+		}
+
+		writer.writeLine("\t}");
+
+		// Single string comparison thanks to the perfect hash, linear search if none could be found
+		PerfectHash perfectHash;
+
+		writer.writeLine("\tstatic constexpr bool FromString(std::string_view name, {}& value) noexcept", enumFullName);
+		writer.writeLine("\t{");
+
+		if (ComputePerfectHash(names, perfectHash))
+		{
+			writer.write("\t\tconstexpr std::array<std::uint32_t, {}> seeds = { ", count);
+			for (std::size_t i = 0u; i < count; i++)
+				writer.write((i == 0u) ? "{}" : ", {}", perfectHash.seeds[i]);
+			writer.write(" };").endLine();
+
+			writer.write("\t\tconstexpr std::array<std::size_t, {}> slotToIndex = { ", count);
+			for (std::size_t i = 0u; i < count; i++)
+				writer.write((i == 0u) ? "{}" : ", {}", perfectHash.slotToIndex[i]);
+			writer.write(" };").endLine();
+
+			writer.writeLine("\t\tstd::uint64_t const hash = ::Darius::Reflection::HashName(name);");
+			writer.writeLine("\t\tstd::size_t const index = slotToIndex[::Darius::Reflection::MixHash(hash ^ seeds[::Darius::Reflection::MixHash(hash) % Count]) % Count];");
+			writer.writeLine("\t\tif (Names[index] != name) return false;");
+			writer.writeLine("\t\tvalue = Values[index];");
+			writer.writeLine("\t\treturn true;");
+		}
+		else
+		{
+			if (env.getLogger() != nullptr)
+				env.getLogger()->log("Could not find a perfect hash for the values of " + enumFullName + ", FromString falls back to a linear search.", kodgen::ILogger::ELogSeverity::Warning);
+
+			writer.writeLine("\t\tfor (std::size_t i = 0u; i < Count; i++)");
+			writer.writeLine("\t\t\tif (Names[i] == name) { value = Values[i]; return true; }");
+			writer.writeLine("\t\treturn false;");
+		}
+
+		writer.writeLine("\t}");
+		writer.writeLine("};");
+
+		return true;
+	}
+
 	virtual bool generateSourceFileHeaderCodeForEntity(kodgen::EntityInfo const& entity,
 		kodgen::Property const& property,
 		std::uint8_t			propertyIndex,
@@ -30,11 +266,18 @@ public:
 		if (enumInfo.enumValues.size() <= 0)
 			return false;
 
-		inout_result += "#include <rttr/registration.h>\n";
-		inout_result += "RTTR_REGISTRATION_PFX(" + enumInfo.name + ") \n";
-		inout_result += "{\n";
-		inout_result += "rttr::registration::enumeration<" + enumInfo.getFullName() + ">(\"" + enumInfo.getFullName() + "\")";
-		inout_result += "(";
+		std::string const enumFullName = enumInfo.getFullName();
+
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 128u + enumInfo.enumValues.size() * 64u);
+
+		writer.write("#include <rttr/registration.h>\n");
+		if (_lazyRegistration)
+			WriteLazyRegistrationPrologue(writer, enumInfo.name, enumFullName);
+		else
+			writer.write("RTTR_REGISTRATION_PFX({}) \n", enumInfo.name);
+		writer.write("{\n");
+		writer.write("rttr::registration::enumeration<{}>(\"{}\")", enumFullName, enumFullName);
+		writer.write("(");
 
 		bool isFirst = true;
 
@@ -43,14 +286,14 @@ public:
 
 			//inout_result += "\n\t.property_readonly(\"" + fieldName + ";
 			if (!isFirst)
-				inout_result += ",";
+				writer.write(",");
 
-			inout_result += "\n\trttr::value(\"" + enumVal.name + "\", " + enumVal.getFullName() + ")";
+			writer.write("\n\trttr::value(\"{}\", {})", enumVal.name, enumVal.getFullName());
 
 			isFirst = false;
 		}
 
-		inout_result += ");\n}\n";
+		writer.write(");\n}\n");
 
 		return true;
 	}
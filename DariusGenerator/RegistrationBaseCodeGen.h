@@ -19,6 +19,12 @@ public:
 		return -1;
 	}
 
+	virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+	{
+		//Only validates the entity in preGenerateCodeForEntity
+		return kodgen::ECodeGenLocationMask::None;
+	}
+
 	virtual bool preGenerateCodeForEntity(kodgen::EntityInfo const& entity, kodgen::Property const& property, std::uint8_t propertyIndex, kodgen::MacroCodeGenEnv& env) noexcept override
 	{
 		kodgen::StructClassInfo const& safeClass = reinterpret_cast<kodgen::StructClassInfo const&>(entity);
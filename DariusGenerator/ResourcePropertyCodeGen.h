@@ -10,6 +10,7 @@
 #include <string>
 
 #include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
+#include "Kodgen/CodeGen/CodeWriter.h"
 
 #include "Utils.hpp"
 
@@ -20,6 +21,11 @@ public:
 		kodgen::MacroPropertyCodeGen("Resource", kodgen::EEntityType::Field)
 	{}
 
+	virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+	{
+		return kodgen::ECodeGenLocationMask::ClassFooter;
+	}
+
 	virtual bool preGenerateCodeForEntity(kodgen::EntityInfo const& entity, kodgen::Property const& property, kodgen::uint8 /* propertyIndex */, kodgen::MacroCodeGenEnv& env) noexcept override
 	{
 		auto const& field = reinterpret_cast<kodgen::FieldInfo const&>(entity);
@@ -85,37 +91,39 @@ public:
 			resourceType = trimmedName.substr(tempPos + 1, trimmedName.size() - tempPos - 2);
 		}
 
-		inout_result += "public:" + env.getSeparator();
-		inout_result += "INLINE void Set" + fieldOfficialName + "(D_RESOURCE::ResourceHandle handle)" + env.getSeparator();
-		inout_result += "{" + env.getSeparator();
-		inout_result += "\tmChangeSignal();" + env.getSeparator();
-		inout_result += "\t_Set" + fieldOfficialName + "(handle);" + env.getSeparator();
-		inout_result += "}" + env.getSeparator();
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 1024u);
+
+		writer.writeLine("public:");
+		writer.writeLine("INLINE void Set{}(D_RESOURCE::ResourceHandle handle)", fieldOfficialName);
+		writer.writeLine("{");
+		writer.writeLine("\tmChangeSignal();");
+		writer.writeLine("\t_Set{}(handle);", fieldOfficialName);
+		writer.writeLine("}");
 
-		inout_result += "INLINE " + resourceType + " const* Get" + fieldOfficialName + "() const" + env.getSeparator();
-		inout_result += "{" + env.getSeparator();
-		inout_result += "\treturn " + field.name + ".Get();" + env.getSeparator();
-		inout_result += "}" + env.getSeparator();
+		writer.writeLine("INLINE {} const* Get{}() const", resourceType, fieldOfficialName);
+		writer.writeLine("{");
+		writer.writeLine("\treturn {}.Get();", field.name);
+		writer.writeLine("}");
 
 		if (property.arguments.size() == 0 || (property.arguments.size() > 0 && property.arguments[0] != "false"))
 		{
-			inout_result += accessSpecifierStr + env.getSeparator();
-			inout_result += "INLINE void _Set" + fieldOfficialName + "(D_RESOURCE::ResourceHandle handle)" + env.getSeparator();
-			inout_result += "{" + env.getSeparator();
-			inout_result += "\t" + field.name + " = D_RESOURCE::GetResource<" + resourceType + ">(handle, *this);" + env.getSeparator();
-			inout_result += "}" + env.getSeparator();
+			writer.writeLine(accessSpecifierStr);
+			writer.writeLine("INLINE void _Set{}(D_RESOURCE::ResourceHandle handle)", fieldOfficialName);
+			writer.writeLine("{");
+			writer.writeLine("\t{} = D_RESOURCE::GetResource<{}>(handle, *this);", field.name, resourceType);
+			writer.writeLine("}");
 		}
 
-		inout_result += "private:" + env.getSeparator();
-		inout_result += "INLINE D_CORE::Uuid __Get" + fieldOfficialName + "_UUID() const" + env.getSeparator();
-		inout_result += "{" + env.getSeparator();
-		inout_result += "\treturn " + field.name + ".IsValid() ? " + field.name + "->GetUuid() : D_CORE::Uuid();" + env.getSeparator();
-		inout_result += "}" + env.getSeparator();
+		writer.writeLine("private:");
+		writer.writeLine("INLINE D_CORE::Uuid __Get{}_UUID() const", fieldOfficialName);
+		writer.writeLine("{");
+		writer.writeLine("\treturn {}.IsValid() ? {}->GetUuid() : D_CORE::Uuid();", field.name, field.name);
+		writer.writeLine("}");
 
-		inout_result += "INLINE void __Set" + fieldOfficialName + "_UUID(D_CORE::Uuid uuid)" + env.getSeparator();
-		inout_result += "{" + env.getSeparator();
-		inout_result += "\t_Set" + fieldOfficialName + "(*D_RESOURCE::GetResource<" + resourceType + ">(uuid, *GetGameObject())); " + env.getSeparator();
-		inout_result += "}" + env.getSeparator();
+		writer.writeLine("INLINE void __Set{}_UUID(D_CORE::Uuid uuid)", fieldOfficialName);
+		writer.writeLine("{");
+		writer.writeLine("\t_Set{}(*D_RESOURCE::GetResource<{}>(uuid, *GetGameObject())); ", fieldOfficialName, resourceType);
+		writer.writeLine("}");
 		return true;
 	}
 
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
+#include "Kodgen/CodeGen/CodeWriter.h"
+
+#include "Utils.hpp"
+
+// Emits a table of { offset, resource type id } of the ResourceRef fields of a class, nested reflected structs and
+// reflected parents included, so that the resource manager can gather the dependencies of objects without walking RTTR properties.
+// The table is built on first use as the offsets of base subobjects are not constant expressions.
+class ResourceRefOffsetsCodeGen : public kodgen::MacroPropertyCodeGen
+{
+	static bool IsFundamentalTypeName(std::string const& typeName)
+	{
+		static constexpr std::string_view fundamentalTypeNames[] =
+		{
+			"bool", "char", "signed char", "unsigned char", "wchar_t", "char8_t", "char16_t", "char32_t",
+			"short", "unsigned short", "int", "unsigned int", "long", "unsigned long", "long long", "unsigned long long",
+			"float", "double", "long double"
+		};
+
+		for (std::string_view fundamentalTypeName : fundamentalTypeNames)
+			if (typeName == fundamentalTypeName)
+				return true;
+
+		return false;
+	}
+
+	// Full name of T in ResourceRef<T>
+	static std::string GetResourceTypeName(kodgen::FieldInfo const& field)
+	{
+		std::string const& canonicalName = field.type.getCanonicalName();
+		std::size_t const begin = canonicalName.find('<');
+		std::size_t const end = canonicalName.rfind('>');
+
+		if (begin == std::string::npos || end == std::string::npos || end <= begin)
+			return canonicalName;
+
+		std::string resourceTypeName = canonicalName.substr(begin + 1u, end - begin - 1u);
+		while (!resourceTypeName.empty() && resourceTypeName.back() == ' ')
+			resourceTypeName.pop_back();
+
+		return resourceTypeName;
+	}
+
+	// Fields which may be reflected structs holding resources themselves, standard library types never are
+	static bool IsNestedCandidate(kodgen::FieldInfo const& field)
+	{
+		std::string const& canonicalName = field.type.getCanonicalName();
+
+		return field.type.typeParts.size() == 1u &&
+			(field.type.typeParts[0].descriptor & kodgen::ETypeDescriptor::Value) != kodgen::ETypeDescriptor::Undefined &&
+			!IsFundamentalTypeName(canonicalName) && canonicalName.rfind("std::", 0u) != 0u;
+	}
+
+public:
+	ResourceRefOffsetsCodeGen() noexcept :
+		kodgen::MacroPropertyCodeGen("Serialize", kodgen::EEntityType::Class | kodgen::EEntityType::Struct)
+	{}
+
+	virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+	{
+		return kodgen::ECodeGenLocationMask::ClassFooter;
+	}
+
+	virtual bool initialGenerateHeaderFileHeaderCode(kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept override
+	{
+		if (!IsPropertyUsedInFile(*this, env))
+			return true;
+
+		// Shared by all generated headers, so guarded
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 1024u);
+
+		writer.writeLine("#ifndef D_RESOURCE_REF_OFFSETS");
+		writer.writeLine("#define D_RESOURCE_REF_OFFSETS");
+		writer.writeLine("#include <array>");
+		writer.writeLine("#include <cstddef>");
+		writer.writeLine("#include <cstdint>");
+		writer.writeLine("#include <memory>");
+		writer.writeLine("#include <span>");
+		writer.writeLine("#include <tuple>");
+		writer.writeLine("#include <type_traits>");
+		writer.writeLine("namespace Darius::Reflection");
+		writer.writeLine("{");
+		writer.writeLine("\tstruct ResourceRefOffset { std::size_t Offset; std::uint64_t ResourceTypeId; };");
+		writer.writeLine("\ttemplate<typename T> constexpr std::size_t ResourceRefCount() noexcept");
+		writer.writeLine("\t{");
+		writer.writeLine("\t\tif constexpr (requires { T::GetResourceRefOffsets(); }) return std::tuple_size_v<std::remove_cvref_t<decltype(T::GetResourceRefOffsets())>>;");
+		writer.writeLine("\t\telse return 0u;");
+		writer.writeLine("\t}");
+		writer.writeLine("\ttemplate<typename T, typename Offsets> constexpr std::size_t AppendResourceRefOffsets(Offsets& offsets, std::size_t index, std::size_t baseOffset) noexcept");
+		writer.writeLine("\t{");
+		writer.writeLine("\t\tif constexpr (requires { T::GetResourceRefOffsets(); })");
+		writer.writeLine("\t\t\tfor (ResourceRefOffset const& ref : T::GetResourceRefOffsets()) offsets[index++] = { baseOffset + ref.Offset, ref.ResourceTypeId };");
+		writer.writeLine("\t\treturn index;");
+		writer.writeLine("\t}");
+		writer.writeLine("\t// visitor(ref, resourceTypeId) is called for every ResourceRef of every object, ref pointing to the ResourceRef itself");
+		writer.writeLine("\ttemplate<typename T, typename Visitor> void ForEachResourceRef(std::span<T> objects, Visitor&& visitor)");
+		writer.writeLine("\t{");
+		writer.writeLine("\t\tusing BytePointer = std::conditional_t<std::is_const_v<T>, std::byte const*, std::byte*>;");
+		writer.writeLine("\t\tauto const& offsets = std::remove_cv_t<T>::GetResourceRefOffsets();");
+		writer.writeLine("\t\tfor (T& object : objects)");
+		writer.writeLine("\t\t\tfor (ResourceRefOffset const& ref : offsets) visitor(reinterpret_cast<BytePointer>(std::addressof(object)) + ref.Offset, ref.ResourceTypeId);");
+		writer.writeLine("\t}");
+		writer.writeLine("}");
+		writer.writeLine("#endif");
+
+		return true;
+	}
+
+	virtual bool generateClassFooterCodeForEntity(kodgen::EntityInfo const& entity,
+		kodgen::Property const& /* property */,
+		std::uint8_t			/* propertyIndex */,
+		kodgen::MacroCodeGenEnv& env,
+		std::string& inout_result) noexcept override
+	{
+		kodgen::StructClassInfo const& clazz = reinterpret_cast<kodgen::StructClassInfo const&>(entity);
+
+		std::vector<kodgen::FieldInfo const*> resourceFields;
+		std::vector<kodgen::FieldInfo const*> nestedFields;
+
+		for (auto const& field : clazz.fields)
+		{
+			if (field.isStatic)
+				continue;
+
+			if (IsResourceField(field))
+				resourceFields.push_back(&field);
+			else if (IsNestedCandidate(field))
+				nestedFields.push_back(&field);
+		}
+
+		// Classes without any candidate nor parent don't get a table, so they count as having no ResourceRef when nested.
+		// Derived classes always get their own one, the table of their parent being relative to the parent subobject
+		if (resourceFields.empty() && nestedFields.empty() && clazz.parents.empty())
+			return true;
+
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 512u + (clazz.parents.size() + resourceFields.size() + nestedFields.size()) * 160u);
+
+		writer.writeLine("public:");
+		writer.writeLine("static auto const& GetResourceRefOffsets() noexcept");
+		writer.writeLine("{");
+		writer.writeLine("\tstatic auto const offsets = []() noexcept");
+		writer.writeLine("\t{");
+		writer.write("\t\tconstexpr std::size_t count = {}u", resourceFields.size());
+		for (auto const& parent : clazz.parents)
+			writer.write(" + ::Darius::Reflection::ResourceRefCount<{}>()", parent.type.getCanonicalName());
+		for (kodgen::FieldInfo const* field : nestedFields)
+			writer.write(" + ::Darius::Reflection::ResourceRefCount<decltype({})>()", field->name);
+		writer.write(";").endLine();
+		writer.writeLine("\t\tstd::array<::Darius::Reflection::ResourceRefOffset, count> result { };");
+		writer.writeLine("\t\tstd::size_t index = 0u;");
+
+		// Offset of each base subobject, from a pointer cast only as the storage is never read.
+		// Only non virtual bases are supported: the location of a virtual base is read from the object itself,
+		// they are detected as a pointer to a virtual base can't be statically cast to a pointer to the derived class
+		if (!clazz.parents.empty())
+		{
+			writer.writeLine("\t\tconstexpr auto isNonVirtualBase = []<typename Base>() { return requires (Base const* base) { static_cast<{} const*>(base); }; };", clazz.name);
+			writer.writeLine("\t\talignas({}) std::byte storage[sizeof({})];", clazz.name, clazz.name);
+		}
+
+		for (auto const& parent : clazz.parents)
+		{
+			writer.writeLine("\t\tstatic_assert(isNonVirtualBase.template operator()<{}>(), \"{} can't list the ResourceRef of its virtual base {}.\");",
+				parent.type.getCanonicalName(), clazz.name, parent.type.getCanonicalName());
+			writer.writeLine("\t\tindex = ::Darius::Reflection::AppendResourceRefOffsets<{}>(result, index, static_cast<std::size_t>(reinterpret_cast<std::byte const*>(static_cast<{} const*>(reinterpret_cast<{} const*>(storage))) - storage));",
+				parent.type.getCanonicalName(), parent.type.getCanonicalName(), clazz.name);
+		}
+
+		// Resource type ids are the StaticTypeId of the resource classes, computed here as resource types are often only forward declared
+		for (kodgen::FieldInfo const* field : resourceFields)
+			writer.writeLine("\t\tresult[index++] = { offsetof({}, {}), 0x{}ull };", clazz.name, field->name, ToHexString(Fnv1a64(GetResourceTypeName(*field))));
+
+		for (kodgen::FieldInfo const* field : nestedFields)
+			writer.writeLine("\t\tindex = ::Darius::Reflection::AppendResourceRefOffsets<decltype({})>(result, index, offsetof({}, {}));", field->name, clazz.name, field->name);
+
+		writer.writeLine("\t\t(void)index;");
+		writer.writeLine("\t\treturn result;");
+		writer.writeLine("\t}();");
+		writer.writeLine("\treturn offsets;");
+		writer.writeLine("}");
+
+		return true;
+	}
+};
\ No newline at end of file
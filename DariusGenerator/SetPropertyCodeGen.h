@@ -8,33 +8,249 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <algorithm>
 
 #include "Kodgen/CodeGen/PropertyCodeGen.h"
+#include "Kodgen/CodeGen/CodeWriter.h"
 
 class SetPropertyCodeGen : public kodgen::MacroPropertyCodeGen
 {
+	// Above this count, the dirty mask is a std::bitset instead of a std::uint64_t
+	static constexpr std::size_t MaxDirtyFieldsInInteger = 64u;
+
+	static bool HasArgument(kodgen::Property const& property, char firstChar)
+	{
+		return std::find_if(property.arguments.cbegin(), property.arguments.cend(), [firstChar](std::string const& arg) { return arg.at(0) == firstChar; }) != property.arguments.cend();
+	}
+
+	// Per-field dirty bits are only tracked in classes opting in with DClass(DirtyFields), as the mask changes their layout
+	static bool HasDirtyFieldsProperty(kodgen::StructClassInfo const& clazz)
+	{
+		return std::find_if(clazz.properties.cbegin(), clazz.properties.cend(), [](kodgen::Property const& prop) { return prop.name == "DirtyFields"; }) != clazz.properties.cend();
+	}
+
+	// Non-static fields with a Set(dirty) property, in declaration order: their index is their bit in the dirty mask
+	static std::vector<kodgen::FieldInfo const*> GetDirtyFields(kodgen::StructClassInfo const& clazz)
+	{
+		std::vector<kodgen::FieldInfo const*> result;
+
+		if (!HasDirtyFieldsProperty(clazz))
+			return result;
+
+		for (auto const& field : clazz.fields)
+		{
+			if (field.isStatic)
+				continue;
+
+			for (auto const& prop : field.properties)
+			{
+				if (prop.name == "Set" && HasArgument(prop, 'd'))
+				{
+					result.push_back(&field);
+					break;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	static std::string GetMarkDirtyStatement(std::size_t bitIndex, std::size_t dirtyFieldsCount)
+	{
+		return (dirtyFieldsCount > MaxDirtyFieldsInInteger) ?
+			"mDirtyFields.set(" + std::to_string(bitIndex) + "); " :
+			"mDirtyFields |= (std::uint64_t(1u) << " + std::to_string(bitIndex) + "); ";
+	}
+
+	static std::string GetIsDirtyExpression(std::string const& mask, std::size_t bitIndex, std::size_t dirtyFieldsCount)
+	{
+		return (dirtyFieldsCount > MaxDirtyFieldsInInteger) ?
+			mask + ".test(" + std::to_string(bitIndex) + ")" :
+			"(" + mask + " >> " + std::to_string(bitIndex) + ") & 1u";
+	}
+
+	// Setter body between the braces, dirtyFieldsCount being 0 if the field has no bit in a dirty mask
+	static std::string GetSetterBody(kodgen::FieldInfo const& field, std::string const& paramName, bool isDirtyable, bool skipEqual, std::size_t bitIndex, std::size_t dirtyFieldsCount)
+	{
+		std::string body = isDirtyable ? "if(!CanChange()) return; " : "";
+
+		if (skipEqual)
+			body += "if(" + field.name + " == " + paramName + ") return; ";
+
+		body += field.name + " = " + paramName + "; ";
+
+		if (isDirtyable)
+		{
+			if (dirtyFieldsCount != 0u)
+				body += GetMarkDirtyStatement(bitIndex, dirtyFieldsCount);
+
+			body += "SetDirty(); ";
+		}
+
+		return body;
+	}
+
+	// Dirty mask, its accessors and the delta serializers, generated once per class along with the first dirty field
+	static void WriteDirtyMask(kodgen::CodeWriter& writer, std::vector<kodgen::FieldInfo const*> const& dirtyFields)
+	{
+		std::size_t const count = dirtyFields.size();
+		bool const isBitset = count > MaxDirtyFieldsInInteger;
+
+		writer.writeLine("private: ");
+		if (isBitset)
+			writer.writeLine("std::bitset<{}> mDirtyFields;", count);
+		else
+			writer.writeLine("std::uint64_t mDirtyFields = 0u;");
+
+		writer.writeLine("public: ");
+		writer.writeLine("static constexpr std::size_t DirtyFieldsCount = {};", count);
+		writer.writeLine("INLINE bool IsFieldDirty(std::size_t bitIndex) const { return {}; }", isBitset ? "mDirtyFields.test(bitIndex)" : "((mDirtyFields >> bitIndex) & 1u) != 0u");
+		writer.writeLine("INLINE bool HasDirtyFields() const { return {}; }", isBitset ? "mDirtyFields.any()" : "mDirtyFields != 0u");
+		writer.writeLine("INLINE void ClearDirtyFields() { {}; }", isBitset ? "mDirtyFields.reset()" : "mDirtyFields = 0u");
+
+		// Templates so that the fields only need to be serializable if the delta serializers are used
+		writer.writeLine("template<typename ByteVector = std::vector<std::byte>>");
+		writer.writeLine("INLINE void SerializeDirtyFieldsBinary(ByteVector& out) const");
+		writer.writeLine("{");
+		writer.writeLine("	::Darius::Reflection::SerializeField(mDirtyFields, out);");
+
+		for (std::size_t i = 0u; i < count; i++)
+			writer.writeLine("	if ({}) ::Darius::Reflection::SerializeField({}, out);", GetIsDirtyExpression("mDirtyFields", i, count), dirtyFields[i]->name);
+
+		writer.writeLine("}");
+
+		// The read fields are not marked dirty: the delta comes from the object owning the changes
+		writer.writeLine("template<typename Byte = std::byte>");
+		writer.writeLine("INLINE Byte const* DeserializeDirtyFieldsBinary(Byte const* in, Byte const* end)");
+		writer.writeLine("{");
+		writer.writeLine("	decltype(mDirtyFields) dirtyFields;");
+		writer.writeLine("	in = ::Darius::Reflection::DeserializeField(dirtyFields, in, end);");
+		writer.writeLine("	if (in == nullptr) return nullptr;");
+
+		for (std::size_t i = 0u; i < count; i++)
+			writer.writeLine("	if ({}) { in = ::Darius::Reflection::DeserializeField({}, in, end); if (in == nullptr) return nullptr; }", GetIsDirtyExpression("dirtyFields", i, count), dirtyFields[i]->name);
+
+		writer.writeLine("	return in;");
+		writer.writeLine("}");
+	}
+
+	// Dirty fields of the last visited class and the bit of each of its fields, fields being generated class by class.
+	// Reset before each file as the entities of the previous one are freed, so their addresses can be reused
+	kodgen::StructClassInfo const*			_dirtyFieldsClass = nullptr;
+	std::vector<kodgen::FieldInfo const*>	_dirtyFields;
+	std::vector<std::size_t>				_dirtyFieldBits;
+
+	std::vector<kodgen::FieldInfo const*> const& GetClassDirtyFields(kodgen::FieldInfo const& field)
+	{
+		kodgen::StructClassInfo const& clazz = reinterpret_cast<kodgen::StructClassInfo const&>(*field.outerEntity);
+
+		if (_dirtyFieldsClass != &clazz)
+		{
+			_dirtyFieldsClass = &clazz;
+			_dirtyFields = GetDirtyFields(clazz);
+			_dirtyFieldBits.assign(clazz.fields.size(), 0u);
+
+			for (std::size_t i = 0u; i < _dirtyFields.size(); i++)
+				_dirtyFieldBits[_dirtyFields[i] - clazz.fields.data()] = i;
+		}
+
+		return _dirtyFields;
+	}
+
+	std::size_t GetDirtyFieldBit(kodgen::FieldInfo const& field)
+	{
+		GetClassDirtyFields(field);
+
+		return _dirtyFieldBits[&field - _dirtyFieldsClass->fields.data()];
+	}
+
 public:
 	SetPropertyCodeGen() noexcept :
 		kodgen::MacroPropertyCodeGen("Set", kodgen::EEntityType::Field)
 	{}
 
+	virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+	{
+		return kodgen::ECodeGenLocationMask::ClassFooter | kodgen::ECodeGenLocationMask::SourceFileHeader;
+	}
+
+	virtual bool initialGenerateHeaderFileHeaderCode(kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept override
+	{
+		_dirtyFieldsClass = nullptr;
+		_dirtyFields.clear();
+		_dirtyFieldBits.clear();
+
+		bool hasDirtyFields = false;
+
+		env.getFileParsingResult()->foreachEntityOfType(kodgen::EEntityType::Class | kodgen::EEntityType::Struct, [&hasDirtyFields](kodgen::EntityInfo const& entity)
+			{
+				if (!hasDirtyFields && !GetDirtyFields(static_cast<kodgen::StructClassInfo const&>(entity)).empty())
+					hasDirtyFields = true;
+			});
+
+		// Runtime of the dirty masks, shared by all generated headers so guarded
+		if (!hasDirtyFields)
+			return true;
+
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 2048u);
+
+		writer.writeLine("#ifndef D_DIRTY_FIELDS");
+		writer.writeLine("#define D_DIRTY_FIELDS");
+		writer.writeLine("#include <bitset>");
+		writer.writeLine("#include <cstddef>");
+		writer.writeLine("#include <cstdint>");
+		writer.writeLine("#include <cstring>");
+		writer.writeLine("#include <memory>");
+		writer.writeLine("#include <type_traits>");
+		writer.writeLine("#include <vector>");
+		writer.writeLine("namespace Darius::Reflection");
+		writer.writeLine("{");
+		writer.writeLine("\t// Fields providing SerializeBinary / DeserializeBinary use them, others are copied bytewise");
+		writer.writeLine("\ttemplate<typename Field, typename ByteVector> void SerializeField(Field const& field, ByteVector& out)");
+		writer.writeLine("\t{");
+		writer.writeLine("\t\tif constexpr (requires { field.SerializeBinary(out); }) field.SerializeBinary(out);");
+		writer.writeLine("\t\telse");
+		writer.writeLine("\t\t{");
+		writer.writeLine("\t\t\tstatic_assert(std::is_trivially_copyable_v<Field>, \"Dirty fields must be trivially copyable or provide SerializeBinary.\");");
+		writer.writeLine("\t\t\tout.resize(out.size() + sizeof(Field));");
+		writer.writeLine("\t\t\tstd::memcpy(out.data() + out.size() - sizeof(Field), std::addressof(field), sizeof(Field));");
+		writer.writeLine("\t\t}");
+		writer.writeLine("\t}");
+		writer.writeLine("\ttemplate<typename Field, typename Byte> Byte const* DeserializeField(Field& field, Byte const* in, Byte const* end)");
+		writer.writeLine("\t{");
+		writer.writeLine("\t\tif constexpr (requires { field.DeserializeBinary(in, end); }) return field.DeserializeBinary(in, end);");
+		writer.writeLine("\t\telse");
+		writer.writeLine("\t\t{");
+		writer.writeLine("\t\t\tstatic_assert(std::is_trivially_copyable_v<Field>, \"Dirty fields must be trivially copyable or provide DeserializeBinary.\");");
+		writer.writeLine("\t\t\tif (end - in < static_cast<std::ptrdiff_t>(sizeof(Field))) return nullptr;");
+		writer.writeLine("\t\t\tstd::memcpy(std::addressof(field), in, sizeof(Field));");
+		writer.writeLine("\t\t\treturn in + sizeof(Field);");
+		writer.writeLine("\t\t}");
+		writer.writeLine("\t}");
+		writer.writeLine("}");
+		writer.writeLine("#endif");
+
+		return true;
+	}
+
 	virtual bool preGenerateCodeForEntity(kodgen::EntityInfo const& /* entity */, kodgen::Property const& property, kodgen::uint8 /* propertyIndex */, kodgen::MacroCodeGenEnv& env) noexcept override
 	{
 		std::string errorMessage;
 
 		//Check that Set property arguments are valid
-		if (property.arguments.size() > 2)
+		if (property.arguments.size() > 3)
 		{
-			errorMessage = "Set property can't take more than two argument.";
+			errorMessage = "Set property can't take more than three arguments.";
 		}
 		else
 		{
 			//Check that Get property arguments are valid
 			for (std::string const& arg : property.arguments)
 			{
-				if (arg != "inline" && arg != "explicit" && arg != "dirty")
+				if (arg != "inline" && arg != "explicit" && arg != "dirty" && arg != "skipEqual")
 				{
-					errorMessage = "Get property only accepts 'inline', and 'explicit argument.";
+					errorMessage = "Set property only accepts 'inline', 'explicit', 'dirty' and 'skipEqual' arguments.";
 					break;
 				}
 			}
@@ -73,6 +289,7 @@ public:
 
 		bool isInline = false;
 		bool dirty = false;
+		bool skipEqual = false;
 
 		// Extracting property arguments
 		for (std::string const& subprop : property.arguments)
@@ -81,6 +298,8 @@ public:
 				isInline = true;
 			else if (subprop.at(0) == 'd')		// dirty
 				dirty = true;
+			else if (subprop.at(0) == 's')		// skipEqual
+				skipEqual = true;
 		}
 
 
@@ -120,17 +339,26 @@ public:
 			preTypeQualifiers += "static ";
 		}
 
-		inout_result += "public: " + env.getSeparator();
+		kodgen::CodeWriter writer(inout_result, env.getSeparator());
 
-		if (isInline)
+		std::size_t dirtyFieldsCount = 0u;
+
+		if (dirty && !field.isStatic)
 		{
-			if (dirty)
-				inout_result += preTypeQualifiers + "void " + methodName + " { if(!CanChange()) return; " + field.name + " = " + paramName + "; SetDirty(); }" + env.getSeparator();
-			else
-				inout_result += preTypeQualifiers + "void " + methodName + " { " + field.name + " = " + paramName + "; }" + env.getSeparator();
+			std::vector<kodgen::FieldInfo const*> const& dirtyFields = GetClassDirtyFields(field);
+
+			if (!dirtyFields.empty() && dirtyFields.front() == &field)
+				WriteDirtyMask(writer, dirtyFields);
+
+			dirtyFieldsCount = dirtyFields.size();
 		}
+
+		writer.writeLine("public: ");
+
+		if (isInline)
+			writer.writeLine("{}void {} { {}}", preTypeQualifiers, methodName, GetSetterBody(field, paramName, dirty, skipEqual, (dirtyFieldsCount != 0u) ? GetDirtyFieldBit(field) : 0u, dirtyFieldsCount));
 		else
-			inout_result += preTypeQualifiers + "void " + methodName + ";" + env.getSeparator();
+			writer.writeLine("{}void {};", preTypeQualifiers, methodName);
 
 
 		return true;
@@ -145,6 +373,7 @@ public:
 		bool				isInline = false;
 		bool				isExplicit = false;
 		bool				isDirtyable = false;
+		bool				skipEqual = false;
 
 		// Extracting property arguments
 		for (std::string const& subprop : property.arguments)
@@ -163,6 +392,10 @@ public:
 			{
 				isDirtyable = true;
 			}
+			else if (subprop.at(0) == 's')		// skipEqual
+			{
+				skipEqual = true;
+			}
 		}
 
 
@@ -191,10 +424,11 @@ public:
 
 		methodName += ")";
 
-		if (isDirtyable)
-			inout_result += preTypeQualifiers + "void " + entity.outerEntity->getFullName() + "::" + methodName + " { if(!CanChange()) return; " + field.name + " = " + paramName + "; SetDirty(); }" + env.getSeparator();
-		else
-			inout_result += preTypeQualifiers + "void " + entity.outerEntity->getFullName() + "::" + methodName + " { " + field.name + " = " + paramName + "; }" + env.getSeparator();
+		std::size_t dirtyFieldsCount = (isDirtyable && !field.isStatic) ? GetClassDirtyFields(field).size() : 0u;
+
+		kodgen::CodeWriter(inout_result, env.getSeparator())
+			.writeLine("{}void {}::{} { {}}", preTypeQualifiers, entity.outerEntity->getFullName(), methodName,
+				GetSetterBody(field, paramName, isDirtyable, skipEqual, (dirtyFieldsCount != 0u) ? GetDirtyFieldBit(field) : 0u, dirtyFieldsCount));
 
 		return true;
 	}
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <cctype>
+#include <string>
+#include <vector>
+
+#include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
+#include "Kodgen/CodeGen/CodeWriter.h"
+
+#include "Utils.hpp"
+
+// Generates a Structure-of-Arrays companion container Darius::Reflection::SoA<T> for DStruct(SoA):
+// one cache line aligned column per field, span column accessors, a proxy row reference and AoS <-> SoA conversion.
+class SoACodeGen : public kodgen::MacroPropertyCodeGen
+{
+	struct Column
+	{
+		kodgen::FieldInfo const*	field;
+		std::string					type;
+		std::string					name;	// Field name without the m prefix
+	};
+
+	static bool ComputeColumns(kodgen::StructClassInfo const& clazz, kodgen::MacroCodeGenEnv& env, std::vector<Column>& out_columns)
+	{
+		bool success = true;
+
+		for (auto const& field : clazz.fields)
+		{
+			if (field.isStatic)
+				continue;
+
+			std::string error;
+
+			if (field.accessSpecifier != kodgen::EAccessSpecifier::Public)
+				error = "is not public";
+			else if (IsFieldConst(field))
+				error = "is const";
+			else if (!field.type.typeParts.empty() && (field.type.typeParts.front().descriptor & (kodgen::ETypeDescriptor::CArray | kodgen::ETypeDescriptor::LRef | kodgen::ETypeDescriptor::RRef)) != kodgen::ETypeDescriptor::Undefined)
+				error = "is a C array or a reference";
+
+			if (!error.empty())
+			{
+				if (env.getLogger() != nullptr)
+					env.getLogger()->log("Can't generate the SoA container of " + clazz.getFullName() + ": field " + field.name + " " + error, kodgen::ILogger::ELogSeverity::Error);
+
+				success = false;
+				continue;
+			}
+
+			std::string_view name = field.name;
+			if (name.size() > 1u && name[0] == 'm' && std::isupper(static_cast<unsigned char>(name[1])))
+				name.remove_prefix(1u);
+
+			out_columns.push_back(Column{ &field, field.type.getCanonicalName(), std::string(name) });
+		}
+
+		return success;
+	}
+
+public:
+	SoACodeGen() noexcept :
+		kodgen::MacroPropertyCodeGen("SoA", kodgen::EEntityType::Struct)
+	{}
+
+	virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+	{
+		return kodgen::ECodeGenLocationMask::HeaderFileFooter;
+	}
+
+	virtual bool initialGenerateHeaderFileHeaderCode(kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept override
+	{
+		if (!IsPropertyUsedInFile(*this, env))
+			return true;
+
+		// Column storage is shared by all generated headers, so guarded.
+		// std::vector is not used since std::vector<bool> can't provide spans nor references to its elements
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 4096u);
+
+		writer.writeLine("#ifndef D_SOA_CONTAINER");
+		writer.writeLine("#define D_SOA_CONTAINER");
+		writer.writeLine("#include <cstddef>");
+		writer.writeLine("#include <memory>");
+		writer.writeLine("#include <new>");
+		writer.writeLine("#include <span>");
+		writer.writeLine("#include <utility>");
+		writer.writeLine("namespace Darius::Reflection");
+		writer.writeLine("{");
+		writer.writeLine("\ttemplate<typename T> class SoA;");
+		writer.writeLine("\tinline constexpr std::size_t SoAColumnAlignment = 64u;");
+		writer.writeLine("\ttemplate<typename T>");
+		writer.writeLine("\tclass SoAColumn");
+		writer.writeLine("\t{");
+		writer.writeLine("\tpublic:");
+		writer.writeLine("\t\tSoAColumn() noexcept = default;");
+		writer.writeLine("\t\tSoAColumn(SoAColumn const& other) : SoAColumn() { Reserve(other.mSize); std::uninitialized_copy_n(other.mData, other.mSize, mData); mSize = other.mSize; }");
+		writer.writeLine("\t\tSoAColumn(SoAColumn&& other) noexcept : mData(std::exchange(other.mData, nullptr)), mSize(std::exchange(other.mSize, 0u)), mCapacity(std::exchange(other.mCapacity, 0u)) { }");
+		writer.writeLine("\t\tSoAColumn& operator=(SoAColumn other) noexcept { std::swap(mData, other.mData); std::swap(mSize, other.mSize); std::swap(mCapacity, other.mCapacity); return *this; }");
+		writer.writeLine("\t\t~SoAColumn() { std::destroy_n(mData, mSize); ::operator delete(mData, Alignment); }");
+		writer.writeLine("\t\tT* Data() noexcept { return mData; }");
+		writer.writeLine("\t\tT const* Data() const noexcept { return mData; }");
+		writer.writeLine("\t\tstd::size_t Size() const noexcept { return mSize; }");
+		writer.writeLine("\t\tstd::size_t Capacity() const noexcept { return mCapacity; }");
+		writer.writeLine("\t\tT& operator[](std::size_t index) noexcept { return mData[index]; }");
+		writer.writeLine("\t\tT const& operator[](std::size_t index) const noexcept { return mData[index]; }");
+		writer.writeLine("\t\tvoid Reserve(std::size_t capacity)");
+		writer.writeLine("\t\t{");
+		writer.writeLine("\t\t\tif (capacity <= mCapacity) return;");
+		writer.writeLine("\t\t\tT* data = static_cast<T*>(::operator new(capacity * sizeof(T), Alignment));");
+		writer.writeLine("\t\t\tstd::uninitialized_move_n(mData, mSize, data);");
+		writer.writeLine("\t\t\tstd::destroy_n(mData, mSize);");
+		writer.writeLine("\t\t\t::operator delete(mData, Alignment);");
+		writer.writeLine("\t\t\tmData = data;");
+		writer.writeLine("\t\t\tmCapacity = capacity;");
+		writer.writeLine("\t\t}");
+		writer.writeLine("\t\tvoid Resize(std::size_t size)");
+		writer.writeLine("\t\t{");
+		writer.writeLine("\t\t\tReserve(size);");
+		writer.writeLine("\t\t\tif (size > mSize) std::uninitialized_value_construct_n(mData + mSize, size - mSize);");
+		writer.writeLine("\t\t\telse std::destroy_n(mData + size, mSize - size);");
+		writer.writeLine("\t\t\tmSize = size;");
+		writer.writeLine("\t\t}");
+		writer.writeLine("\t\tvoid PushBack(T const& value)");
+		writer.writeLine("\t\t{");
+		writer.writeLine("\t\t\tif (mSize == mCapacity) { T copy(value); Reserve(mCapacity != 0u ? mCapacity * 2u : 16u); ::new (static_cast<void*>(mData + mSize)) T(std::move(copy)); }");
+		writer.writeLine("\t\t\telse ::new (static_cast<void*>(mData + mSize)) T(value);");
+		writer.writeLine("\t\t\tmSize++;");
+		writer.writeLine("\t\t}");
+		writer.writeLine("\t\tvoid PopBack() noexcept { std::destroy_at(mData + --mSize); }");
+		writer.writeLine("\t\tvoid Clear() noexcept { std::destroy_n(mData, mSize); mSize = 0u; }");
+		writer.writeLine("\tprivate:");
+		writer.writeLine("\t\tstatic constexpr std::align_val_t Alignment { SoAColumnAlignment > alignof(T) ? SoAColumnAlignment : alignof(T) };");
+		writer.writeLine("\t\tT* mData = nullptr;");
+		writer.writeLine("\t\tstd::size_t mSize = 0u;");
+		writer.writeLine("\t\tstd::size_t mCapacity = 0u;");
+		writer.writeLine("\t};");
+		writer.writeLine("}");
+		writer.writeLine("#endif");
+
+		return true;
+	}
+
+	virtual bool generateHeaderFileFooterCodeForEntity(kodgen::EntityInfo const& entity,
+		kodgen::Property const& /* property */,
+		std::uint8_t			/* propertyIndex */,
+		kodgen::MacroCodeGenEnv& env,
+		std::string& inout_result) noexcept override
+	{
+		kodgen::StructClassInfo const& clazz = reinterpret_cast<kodgen::StructClassInfo const&>(entity);
+
+		std::vector<Column> columns;
+		if (!ComputeColumns(clazz, env, columns))
+			return false;
+
+		std::string const structFullName = clazz.getFullName();
+
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 1024u + columns.size() * 640u);
+
+		writer.writeLine("template<>");
+		writer.writeLine("class Darius::Reflection::SoA<{}>", structFullName);
+		writer.writeLine("{");
+		writer.writeLine("public:");
+		writer.writeLine("\tusing ValueType = {};", structFullName);
+		writer.writeLine("\tstatic constexpr std::size_t ColumnCount = {};", columns.size());
+
+		// Proxy rows, exposing the fields of a row under their struct name
+		for (bool isConst : { false, true })
+		{
+			writer.writeLine("\tstruct {}", isConst ? "ConstReference" : "Reference");
+			writer.writeLine("\t{");
+			for (Column const& column : columns)
+				writer.writeLine("\t\t{}{}& {};", column.type, isConst ? " const" : "", column.field->name);
+
+			writer.write("\t\toperator ValueType() const { ValueType value;");
+			for (Column const& column : columns)
+				writer.write(" value.{} = {};", column.field->name, column.field->name);
+			writer.write(" return value; }").endLine();
+
+			if (!isConst)
+			{
+				writer.write("\t\tReference& operator=(ValueType const& value) {");
+				for (Column const& column : columns)
+					writer.write(" {} = value.{};", column.field->name, column.field->name);
+				writer.write(" return *this; }").endLine();
+			}
+			writer.writeLine("\t};");
+		}
+
+		writer.writeLine("\tSoA() = default;");
+		writer.writeLine("\texplicit SoA(std::span<ValueType const> values) { FromAoS(values); }");
+
+		writer.writeLine("\tstd::size_t Size() const noexcept { return {}.Size(); }", columns.empty() ? "mSize" : "m" + columns.front().name + "Column");
+		writer.writeLine("\tbool Empty() const noexcept { return Size() == 0u; }");
+
+		// Operations forwarded to all the columns
+		auto writeForEachColumn = [&writer, &columns](std::string_view signature, std::string_view call, std::string_view sizeUpdate)
+			{
+				writer.write("\t{} {", signature);
+				for (Column const& column : columns)
+					writer.write(" m{}Column.{};", column.name, call);
+				if (columns.empty())
+					writer.write(" {}", sizeUpdate);
+				writer.write(" }").endLine();
+			};
+
+		writeForEachColumn("void Reserve(std::size_t capacity)", "Reserve(capacity)", "(void)capacity;");
+		writeForEachColumn("void Resize(std::size_t size)", "Resize(size)", "mSize = size;");
+		writeForEachColumn("void Clear() noexcept", "Clear()", "mSize = 0u;");
+		writeForEachColumn("void PopBack() noexcept", "PopBack()", "mSize--;");
+
+		writer.write("\tvoid PushBack(ValueType const& value) {");
+		for (Column const& column : columns)
+			writer.write(" m{}Column.PushBack(value.{});", column.name, column.field->name);
+		if (columns.empty())
+			writer.write(" (void)value; mSize++;");
+		writer.write(" }").endLine();
+
+		// Row access
+		writer.write("\tReference operator[](std::size_t index) noexcept { return Reference{");
+		for (std::size_t i = 0u; i < columns.size(); i++)
+			writer.write((i == 0u) ? " m{}Column[index]" : ", m{}Column[index]", columns[i].name);
+		writer.write(" }; }").endLine();
+
+		writer.write("\tConstReference operator[](std::size_t index) const noexcept { return ConstReference{");
+		for (std::size_t i = 0u; i < columns.size(); i++)
+			writer.write((i == 0u) ? " m{}Column[index]" : ", m{}Column[index]", columns[i].name);
+		writer.write(" }; }").endLine();
+
+		writer.writeLine("\tValueType Get(std::size_t index) const { return (*this)[index]; }");
+		writer.writeLine("\tvoid Set(std::size_t index, ValueType const& value) { (*this)[index] = value; }");
+
+		// Columns, the data hot loops iterate over
+		for (Column const& column : columns)
+		{
+			writer.writeLine("\tstd::span<{}> {}Column() noexcept { return { m{}Column.Data(), m{}Column.Size() }; }", column.type, column.name, column.name, column.name);
+			writer.writeLine("\tstd::span<{} const> {}Column() const noexcept { return { m{}Column.Data(), m{}Column.Size() }; }", column.type, column.name, column.name, column.name);
+		}
+
+		// AoS <-> SoA conversion, column by column to write a single stream at a time
+		writer.writeLine("\tvoid FromAoS(std::span<ValueType const> values)");
+		writer.writeLine("\t{");
+		writer.writeLine("\t\tClear();");
+		writer.writeLine("\t\tReserve(values.size());");
+		for (Column const& column : columns)
+			writer.writeLine("\t\tfor (ValueType const& value : values) m{}Column.PushBack(value.{});", column.name, column.field->name);
+		if (columns.empty())
+			writer.writeLine("\t\tmSize = values.size();");
+		writer.writeLine("\t}");
+
+		writer.writeLine("\tstd::size_t ToAoS(std::span<ValueType> out) const");
+		writer.writeLine("\t{");
+		writer.writeLine("\t\tstd::size_t const count = out.size() < Size() ? out.size() : Size();");
+		for (Column const& column : columns)
+			writer.writeLine("\t\tfor (std::size_t i = 0u; i < count; i++) out[i].{} = m{}Column[i];", column.field->name, column.name);
+		writer.writeLine("\t\treturn count;");
+		writer.writeLine("\t}");
+
+		writer.writeLine("private:");
+		for (Column const& column : columns)
+			writer.writeLine("\t::Darius::Reflection::SoAColumn<{}> m{}Column;", column.type, column.name);
+		if (columns.empty())
+			writer.writeLine("\tstd::size_t mSize = 0u;");
+		writer.writeLine("};");
+
+		return true;
+	}
+};
\ No newline at end of file
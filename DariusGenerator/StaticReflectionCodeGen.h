@@ -0,0 +1,127 @@
+#pragma once
+
+#include <string>
+
+#include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
+#include "Kodgen/CodeGen/CodeWriter.h"
+
+#include "Utils.hpp"
+
+// Opt-in alternative to the RTTR registration of ReflectionBaseCodeGen:
+// emits a constexpr field descriptor table and a ForEachField visitor in the class body,
+// so fields can be iterated without any runtime registration.
+// Offsets come from offsetof, which is only conditionally-supported on the non standard-layout classes RTTR_ENABLE makes polymorphic:
+// MSVC accepts it, GCC and Clang too with a -Winvalid-offsetof warning, but none of them on classes with virtual bases.
+class StaticReflectionCodeGen : public kodgen::MacroPropertyCodeGen
+{
+
+public:
+	StaticReflectionCodeGen() noexcept :
+		kodgen::MacroPropertyCodeGen("Serialize", kodgen::EEntityType::Class | kodgen::EEntityType::Struct)
+	{}
+
+	virtual kodgen::ECodeGenLocationMask getEntityCodeLocations() const noexcept override
+	{
+		return kodgen::ECodeGenLocationMask::ClassFooter;
+	}
+
+	virtual bool initialGenerateHeaderFileHeaderCode(kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept override
+	{
+		if (!IsPropertyUsedInFile(*this, env))
+			return true;
+
+		// Descriptor types are shared by all generated headers, so they are guarded
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 512u);
+
+		writer.writeLine("#ifndef D_STATIC_REFLECTION_DESCRIPTORS");
+		writer.writeLine("#define D_STATIC_REFLECTION_DESCRIPTORS");
+		writer.writeLine("#include <array>");
+		writer.writeLine("#include <cstddef>");
+		writer.writeLine("#include <cstdint>");
+		writer.writeLine("#include <string_view>");
+		writer.writeLine("namespace Darius::Reflection");
+		writer.writeLine("{");
+		writer.writeLine("\tenum EFieldFlags : std::uint32_t { None = 0u, NoSerialize = 1u << 0, Animate = 1u << 1, ReadOnly = 1u << 2 };");
+		writer.writeLine("\tstruct FieldDescriptor { std::string_view Name; std::size_t Offset; std::size_t Size; std::uint64_t TypeId; std::uint32_t Flags; };");
+		writer.writeLine("}");
+		writer.writeLine("#endif");
+
+		return true;
+	}
+
+	virtual bool generateClassFooterCodeForEntity(kodgen::EntityInfo const& entity,
+		kodgen::Property const& /* property */,
+		std::uint8_t			/* propertyIndex */,
+		kodgen::MacroCodeGenEnv& env,
+		std::string& inout_result) noexcept override
+	{
+		kodgen::StructClassInfo const& clazz = reinterpret_cast<kodgen::StructClassInfo const&>(entity);
+
+		// Static fields have no offset in the instance, and offsetof is ill-formed on bit-fields
+		std::vector<kodgen::FieldInfo const*> fields;
+		for (auto const& field : clazz.fields)
+		{
+			if (field.isStatic)
+				continue;
+
+			if (field.isBitField)
+			{
+				if (env.getLogger() != nullptr)
+					env.getLogger()->log("Bit-field " + field.getFullName() + " is left out of the static reflection of " + clazz.getFullName() + ".", kodgen::ILogger::ELogSeverity::Warning);
+
+				continue;
+			}
+
+			fields.push_back(&field);
+		}
+
+		kodgen::CodeWriter writer(inout_result, env.getSeparator(), 512u + fields.size() * 160u);
+
+		writer.writeLine("public:");
+		writer.writeLine("static constexpr std::array<::Darius::Reflection::FieldDescriptor, {}> GetFieldDescriptors() noexcept", fields.size());
+		writer.writeLine("{");
+		writer.writeLine("\treturn {{");
+
+		for (kodgen::FieldInfo const* field : fields)
+		{
+			bool isConst;
+			bool isSerializable;
+			bool isAnimatable;
+
+			GetFieldInfo(*field, isConst, isSerializable, isAnimatable);
+
+			std::string_view fieldName = field->name;
+			if (fieldName[0] == 'm')
+				fieldName.remove_prefix(1u);
+
+			// Type ids are computed here once, from the canonical name so that aliases share the same id
+			writer.writeLine("\t\t{ \"{}\", offsetof({}, {}), sizeof({}::{}), 0x{}ull, {}{}{}0u },", fieldName, clazz.name, field->name, clazz.name, field->name,
+				ToHexString(Fnv1a64(field->type.getCanonicalName())),
+				isSerializable ? "" : "::Darius::Reflection::NoSerialize | ",
+				isAnimatable ? "::Darius::Reflection::Animate | " : "",
+				isConst ? "::Darius::Reflection::ReadOnly | " : "");
+		}
+
+		writer.writeLine("\t}};");
+		writer.writeLine("}");
+
+		// visitor(FieldDescriptor const&, FieldType&) is called for each field, in declaration order
+		for (char const* constQualifier : { "", " const" })
+		{
+			writer.writeLine("template<typename Visitor>");
+			writer.writeLine("INLINE void ForEachField(Visitor&& visitor){}", constQualifier);
+			writer.writeLine("{");
+			if (fields.empty())
+				writer.writeLine("\t(void)visitor;");
+			else
+				writer.writeLine("\tconstexpr auto descriptors = GetFieldDescriptors();");
+
+			for (std::size_t i = 0u; i < fields.size(); i++)
+				writer.writeLine("\tvisitor(descriptors[{}], {});", i, fields[i]->name);
+
+			writer.writeLine("}");
+		}
+
+		return true;
+	}
+};
\ No newline at end of file
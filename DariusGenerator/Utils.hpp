@@ -1,6 +1,55 @@
 #pragma once
 
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
 #include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
+#include "Kodgen/Misc/Helpers.h"
+
+// 64-bit FNV-1a hash, stable across compilers and runs (unlike std::hash)
+constexpr std::uint64_t Fnv1a64(std::string_view str)
+{
+	return kodgen::Helpers::fnv1a64(str);
+}
+
+// Fixed width lowercase hexadecimal representation, without prefix
+std::string ToHexString(std::uint64_t value)
+{
+	char buffer[17];
+	std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(value));
+
+	return buffer;
+}
+
+// 64-bit finalizer of MurmurHash3, spreads the bits of an already computed hash
+constexpr std::uint64_t Mix64(std::uint64_t hash)
+{
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdull;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ull;
+	hash ^= hash >> 33;
+
+	return hash;
+}
+
+// Whether an entity of the generated file has the property of the code generator.
+// The runtimes shared by all generated headers are written once per file using them, from the initial code of the file
+bool IsPropertyUsedInFile(kodgen::PropertyCodeGen const& codeGen, kodgen::CodeGenEnv const& env)
+{
+	bool isUsed = false;
+
+	env.getFileParsingResult()->foreachEntityOfType(codeGen.getEligibleEntityMask(), [&codeGen, &isUsed](kodgen::EntityInfo const& entity)
+		{
+			for (auto const& prop : entity.properties)
+				if (prop.name == codeGen.getPropertyName())
+					isUsed = true;
+		});
+
+	return isUsed;
+}
 
 bool IsFieldConst(kodgen::FieldInfo const& field)
 {
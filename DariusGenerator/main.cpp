@@ -5,37 +5,39 @@
 #include <Kodgen/Misc/Filesystem.h>
 #include <Kodgen/Misc/DefaultLogger.h>
 
+#include <cstdlib>
+#include <fstream>
+#include <string_view>
+
 #include "GetSetCGM.h"
+#include "GeneratorSetup.hpp"
 
-void initCodeGenUnitSettings(fs::path const& outputDirectory, kodgen::MacroCodeGenUnitSettings& out_cguSettings)
-{
-	//All generated files will be located in WorkingDir/Include/Generated
-	out_cguSettings.setOutputDirectory(outputDirectory);
-	
-	//Setup generated files name pattern
-	out_cguSettings.setGeneratedHeaderFileNamePattern("##FILENAME##.generated.hpp");
-	out_cguSettings.setGeneratedSourceFileNamePattern("##FILENAME##.sgenerated.hpp");
-	out_cguSettings.setClassFooterMacroPattern("##CLASSFULLNAME##_GENERATED");
-	out_cguSettings.setHeaderFileFooterMacroPattern("File_##FILENAME##_GENERATED");
-}
+/** Optional flag used to dump the generation timings to a JSON file: --timings=<path> */
+static constexpr std::string_view timingsFlag = "--timings=";
 
-void initCodeGenManagerSettings(fs::path const& workingDirectory, kodgen::CodeGenManagerSettings& out_generatorSettings)
-{
-	//Parse WorkingDir/...
-	out_generatorSettings.addToProcessDirectory(workingDirectory);
+/** Optional flag used to dump the task timeline to a Chrome Trace Event JSON file: --trace=<path> */
+static constexpr std::string_view traceFlag = "--trace=";
 
-	//Ignore generated files...
-	out_generatorSettings.addIgnoredDirectory(workingDirectory / "Libs");
-	out_generatorSettings.addIgnoredDirectory(workingDirectory / "Generated");
+/** Optional flag used to analyze the memory layout of the parsed structs and classes and dump it to a JSON file: --layout-report=<path> */
+static constexpr std::string_view layoutReportFlag = "--layout-report=";
 
-	//Only parse .hpp files
-	out_generatorSettings.addSupportedFileExtension(".hpp");
-}
+/** Optional flag used to generate constexpr field descriptor tables for Serialize classes and structs: --static-reflection */
+static constexpr std::string_view staticReflectionFlag = "--static-reflection";
+
+/** Optional flag used to abandon any header which takes longer to parse than the given number of seconds: --parse-timeout=<seconds> */
+static constexpr std::string_view parseTimeoutFlag = "--parse-timeout=";
+
+/** Optional flag used to register reflected types with RTTR on first lookup instead of at static initialization: --lazy-registration */
+static constexpr std::string_view lazyRegistrationFlag = "--lazy-registration";
 
 void addIncludeDirectories(int argc, char** argv, kodgen::ParsingSettings& parsingSettings, kodgen::DefaultLogger logger)
 {
 	for (int i = 4; i < argc; i++)
 	{
+		//Skip optional flags
+		if (std::string_view(argv[i]).starts_with("--"))
+			continue;
+
 		auto path = fs::path(argv[i]);
 
 		if (parsingSettings.addProjectIncludeDirectory(path))
@@ -52,52 +54,28 @@ void addIncludeDirectories(int argc, char** argv, kodgen::ParsingSettings& parsi
 	}
 }
 
-bool initParsingSettings(kodgen::ParsingSettings& parsingSettings)
+fs::path getFlagPath(int argc, char** argv, std::string_view flag)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view arg(argv[i]);
+
+		if (arg.starts_with(flag))
+			return fs::path(arg.substr(flag.size()));
+	}
+
+	return fs::path();
+}
+
+bool hasFlag(int argc, char** argv, std::string_view flag)
 {
-	
-	//We abort parsing if we encounter a single error while parsing
-	parsingSettings.shouldAbortParsingOnFirstError = true;
-
-	//Each property will be separed by a ,
-	parsingSettings.propertyParsingSettings.propertySeparator = ',';
-
-	//Subproperties are surrounded by []
-	parsingSettings.propertyParsingSettings.argumentEnclosers[0] = '[';
-	parsingSettings.propertyParsingSettings.argumentEnclosers[1] = ']';
-
-	//Each subproperty will be separed by a ,
-	parsingSettings.propertyParsingSettings.argumentSeparator = ',';
-
-	//Define the macros to use for each entity type
-	parsingSettings.propertyParsingSettings.namespaceMacroName	= "DNamespace";
-	parsingSettings.propertyParsingSettings.classMacroName		= "DClass";
-	parsingSettings.propertyParsingSettings.structMacroName		= "DStruct";
-	parsingSettings.propertyParsingSettings.fieldMacroName		= "DVariable";
-	parsingSettings.propertyParsingSettings.fieldMacroName		= "DField";
-	parsingSettings.propertyParsingSettings.functionMacroName	= "DFunction";
-	parsingSettings.propertyParsingSettings.methodMacroName		= "DMethod";
-	parsingSettings.propertyParsingSettings.enumMacroName		= "DEnum";
-	parsingSettings.propertyParsingSettings.enumValueMacroName	= "DEnumVal";
-
-	parsingSettings.shouldParseAllNamespaces = true;
-	parsingSettings.shouldParseAllEnumValues = true;
-	
-	parsingSettings.shouldLogDiagnostic = false;
-
-	parsingSettings.cppVersion = kodgen::ECppVersion::Cpp20;
-
-	//This is setup that way for CI tools only
-	//In reality, the compiler used by the user machine running the generator should be set.
-	//It has nothing to see with the compiler used to compile the generator.
-//#if defined(__GNUC__)
-//	return parsingSettings.setCompilerExeName("g++");
-//#elif defined(__clang__)
-	return parsingSettings.setCompilerExeName("clang++");
-//#elif defined(_MSC_VER)
-//	return parsingSettings.setCompilerExeName("msvc");
-//#else
-//	return false;	//Unsupported compiler
-//#endif
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::string_view(argv[i]) == flag)
+			return true;
+	}
+
+	return false;
 }
 
 int main(int argc, char** argv)
@@ -142,6 +120,9 @@ int main(int argc, char** argv)
 	auto& settings = fileParser.getSettings();
 
 	addIncludeDirectories(argc, argv, settings, logger);
+
+	//Derive the file ids from paths relative to the working directory so generated files don't depend on the checkout location
+	settings.setProjectRootDirectory(workingDirectory);
 	if (!initParsingSettings(settings))
 	{
 		logger.log("Compiler could not be set because it is not supported on the current machine or vswhere could not be found (Windows|MSVC only).", kodgen::ILogger::ELogSeverity::Error);
@@ -150,6 +131,11 @@ int main(int argc, char** argv)
 
 	logger.log("Using Compiler: " + settings.getCompilerExeName());
 
+	//Each file is parsed on a watched helper thread only when a timeout is requested
+	std::string parseTimeout = getFlagPath(argc, argv, parseTimeoutFlag).string();
+	if (!parseTimeout.empty())
+		settings.parseTimeout = std::strtof(parseTimeout.c_str(), nullptr);
+
 	//Setup code generation unit
 	kodgen::MacroCodeGenUnit codeGenUnit;
 	codeGenUnit.logger = &logger;
@@ -160,6 +146,13 @@ int main(int argc, char** argv)
 
 	//Add code generation modules
 	GetSetCGM getSetCodeGenModule;
+
+	if (hasFlag(argc, argv, staticReflectionFlag))
+		getSetCodeGenModule.enableStaticReflection();
+
+	if (hasFlag(argc, argv, lazyRegistrationFlag))
+		getSetCodeGenModule.enableLazyRegistration();
+
 	codeGenUnit.addModule(getSetCodeGenModule);
 
 	//Setup CodeGenManager
@@ -168,9 +161,61 @@ int main(int argc, char** argv)
 
 	initCodeGenManagerSettings(workingDirectory, codeGenMgr.settings);
 
+	//Padding and cache line warnings are logged by the CodeGenManager, the full report is written after the run
+	fs::path layoutReportOutputPath = getFlagPath(argc, argv, layoutReportFlag);
+	codeGenMgr.settings.shouldAnalyzeStructLayouts = !layoutReportOutputPath.empty();
+
+	//Record the task timeline only if requested
+	fs::path			traceOutputPath = getFlagPath(argc, argv, traceFlag);
+	kodgen::TaskTracer	taskTracer;
+
+	if (!traceOutputPath.empty())
+		codeGenMgr.taskTracer = &taskTracer;
+
 	//Kick-off code generation
 	kodgen::CodeGenResult genResult = codeGenMgr.run(fileParser, codeGenUnit, false);
 
+	if (!traceOutputPath.empty())
+	{
+		if (taskTracer.exportChromeTrace(traceOutputPath))
+			logger.log("Task trace written to " + traceOutputPath.string());
+		else
+			logger.log("Could not write the task trace to " + traceOutputPath.string(), kodgen::ILogger::ELogSeverity::Warning);
+	}
+
+	for (auto const& [timedOutFile, elapsedTime] : genResult.timedOutFiles)
+	{
+		logger.log("Parsing of " + timedOutFile.string() + " timed out after " + std::to_string(elapsedTime) + " seconds.", kodgen::ILogger::ELogSeverity::Error);
+	}
+
+	fs::path timingsOutputPath = getFlagPath(argc, argv, timingsFlag);
+
+	if (!timingsOutputPath.empty())
+	{
+		std::ofstream timingsFile(timingsOutputPath, std::ios::out | std::ios::trunc);
+
+		if (timingsFile.is_open())
+		{
+			timingsFile << genResult.getTimingsAsJson();
+			logger.log("Generation timings written to " + timingsOutputPath.string());
+		}
+		else
+			logger.log("Could not open " + timingsOutputPath.string() + " to write generation timings.", kodgen::ILogger::ELogSeverity::Warning);
+	}
+
+	if (!layoutReportOutputPath.empty())
+	{
+		std::ofstream layoutReportFile(layoutReportOutputPath, std::ios::out | std::ios::trunc);
+
+		if (layoutReportFile.is_open())
+		{
+			layoutReportFile << genResult.getStructLayoutsAsJson();
+			logger.log("Struct layout report written to " + layoutReportOutputPath.string());
+		}
+		else
+			logger.log("Could not open " + layoutReportOutputPath.string() + " to write the struct layout report.", kodgen::ILogger::ELogSeverity::Warning);
+	}
+
 	if (genResult.completed)
 	{
 		logger.log("Generation completed successfully in " + std::to_string(genResult.duration) + " seconds.");
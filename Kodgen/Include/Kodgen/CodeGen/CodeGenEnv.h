@@ -9,6 +9,7 @@
 
 #include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
 #include "Kodgen/Misc/ILogger.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
 
 namespace kodgen
 {
@@ -27,6 +28,9 @@ namespace kodgen
 
 			/** Logger used to log during the code generation process. Can be nullptr. */
 			ILogger*					_logger				= nullptr;
+
+			/** Index (in generation order) of the code generator currently generating code. */
+			uint32						_codeGeneratorIndex	= 0u;
 		
 		public:
 			virtual ~CodeGenEnv() = default;
@@ -44,6 +48,15 @@ namespace kodgen
 			*	@return _logger.
 			*/
 			inline ILogger*					getLogger()				const	noexcept;
+
+			/**
+			*	@brief	Getter for the _codeGeneratorIndex field.
+			*			CodeGenUnit implementations can use it to keep the code of each generator contiguous,
+			*			all code generators being run on an entity before moving to the next one.
+			* 
+			*	@return _codeGeneratorIndex.
+			*/
+			inline uint32					getCodeGeneratorIndex()	const	noexcept;
 	};
 
 	#include "Kodgen/CodeGen/CodeGenEnv.inl"
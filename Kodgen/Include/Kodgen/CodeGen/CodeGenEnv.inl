@@ -13,4 +13,9 @@ inline FileParsingResult const* CodeGenEnv::getFileParsingResult() const noexcep
 inline ILogger* CodeGenEnv::getLogger() const noexcept
 {
 	return _logger;
+}
+
+inline uint32 CodeGenEnv::getCodeGeneratorIndex() const noexcept
+{
+	return _codeGeneratorIndex;
 }
\ No newline at end of file
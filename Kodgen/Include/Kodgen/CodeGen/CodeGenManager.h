@@ -19,6 +19,9 @@
 #include "Kodgen/Parsing/FileParser.h"
 #include "Kodgen/Threading/ThreadPool.h"
 #include "Kodgen/Threading/TaskHelper.h"
+#include "Kodgen/Threading/CancellationToken.h"
+#include "Kodgen/Threading/ThreadJoiner.h"
+#include "Kodgen/Threading/TaskTracer.h"
 
 namespace kodgen
 {
@@ -26,7 +29,19 @@ namespace kodgen
 	{
 		private:
 			/** Thread pool used for files processing. */
-			ThreadPool	_threadPool;
+			ThreadPool			_threadPool;
+
+			/**
+			*	Token triggered on the first parsing error when ParsingSettings::shouldAbortParsingOnFirstError is set.
+			*	Queued tasks and parsers check it to drain the thread pool as fast as possible.
+			*/
+			CancellationToken	_cancellationToken;
+
+			/**
+			*	Helper threads of the parsings which exceeded ParsingSettings::parseTimeout.
+			*	libclang can't interrupt them, so they are joined when the manager is destroyed.
+			*/
+			ThreadJoiner		_timedOutParsingsJoiner;
 
 			/**
 			*	@brief Process all provided files on multiple threads.
@@ -86,6 +101,14 @@ namespace kodgen
 			bool					checkGenerationSetup(FileParser const&	fileParser,
 														 CodeGenUnit const& codeGenUnit)						noexcept;
 
+			/**
+			*	@brief	Log a warning for each analyzed struct/class with at least CodeGenManagerSettings::structLayoutPaddingWarningThreshold
+			*			padding bytes or with fields straddling cache lines.
+			*
+			*	@param genResult Result containing the analyzed struct layouts.
+			*/
+			void					logStructLayoutWarnings(CodeGenResult const& genResult)				const	noexcept;
+
 		public:
 			/** Logger used to issue logs from the CodeGenManager. */
 			ILogger*				logger		= nullptr;
@@ -93,6 +116,12 @@ namespace kodgen
 			/** Struct containing all generation settings. */
 			CodeGenManagerSettings	settings;
 
+			/**
+			*	Optional tracer recording the timeline of a run: every parsing/generation task with its worker thread and file,
+			*	as well as the scan, iteration barriers and results merge on the calling thread. Can be nullptr.
+			*/
+			TaskTracer*				taskTracer	= nullptr;
+
 			/**
 			*	@brief Construct a CodeGenManager that will work with the specified number of threads.
 			* 
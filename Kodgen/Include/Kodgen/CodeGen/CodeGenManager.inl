@@ -24,31 +24,78 @@ void CodeGenManager::processFiles(FileParserType& fileParser, CodeGenUnitType& c
 
 		for (fs::path const& file : toProcessFiles)
 		{
-			auto parsingTaskLambda = [&fileParser, &file](TaskBase*) -> FileParsingResult
+			auto parsingTaskLambda = [this, &fileParser, &file](TaskBase*) -> FileParsingResult
 			{
+				FileParsingResult	parsingResult;
+
+				//Don't even copy the parser if the run has already been cancelled
+				if (_cancellationToken.isCancelled())
+				{
+					parsingResult.errors.emplace_back("Parsing of file " + file.string() + " has been cancelled.");
+
+					return parsingResult;
+				}
+
 				//Copy a parser for this task
 				FileParserType		fileParserCopy = fileParser;
-				FileParsingResult	parsingResult;
+				fileParserCopy.cancellationToken = &_cancellationToken;
+				fileParserCopy.timedOutParsingsJoiner = &_timedOutParsingsJoiner;
 
-				fileParserCopy.parse(file, parsingResult);
+				//A timed out file is not considered fatal, the remaining files keep being processed
+				if (!fileParserCopy.parse(file, parsingResult) && !parsingResult.timedOut && fileParserCopy.getSettings().shouldAbortParsingOnFirstError)
+				{
+					//First fatal error, drain all other queued tasks
+					_cancellationToken.cancel();
+				}
 
 				return parsingResult;
 			};
 
-			auto generationTaskLambda = [&codeGenUnit](TaskBase* parsingTask) -> CodeGenResult
+			auto generationTaskLambda = [this, &codeGenUnit, i](TaskBase* parsingTask) -> CodeGenResult
 			{
 				CodeGenResult out_generationResult;
 
+				if (_cancellationToken.isCancelled())
+				{
+					return out_generationResult;
+				}
+
 				//Copy the generation unit model to have a fresh one for this generation unit
 				CodeGenUnitType	generationUnit = codeGenUnit;
 
 				//Get the result of the parsing task
 				FileParsingResult parsingResult = TaskHelper::getDependencyResult<FileParsingResult>(parsingTask, 0u);
 
+				FileTimings timings;
+				timings.file					= parsingResult.parsedFile;
+				timings.parsingDuration			= parsingResult.parsingDuration;
+				timings.traversalDuration		= parsingResult.traversalDuration;
+				timings.propertyParsingDuration	= parsingResult.propertyParsingDuration;
+
 				//Generate the file if no errors occured during parsing
 				if (parsingResult.errors.empty())
 				{
-					out_generationResult.completed = generationUnit.generateCode(parsingResult);
+					out_generationResult.completed = generationUnit.generateCode(parsingResult, &timings);
+				}
+				else if (parsingResult.timedOut)
+				{
+					out_generationResult.timedOutFiles.emplace_back(parsingResult.parsedFile, parsingResult.parsingDuration);
+				}
+
+				out_generationResult.fileTimings.emplace_back(std::move(timings));
+
+				//Layouts don't change from one iteration to another, analyze them once
+				if (settings.shouldAnalyzeStructLayouts && i == 0 && parsingResult.errors.empty())
+				{
+					parsingResult.foreachEntityOfType(EEntityType::Struct | EEntityType::Class, [&out_generationResult, &parsingResult](EntityInfo const& entity)
+													  {
+														  StructLayout layout;
+
+														  if (StructLayout::compute(static_cast<StructClassInfo const&>(entity), parsingResult.parsedFile, layout))
+														  {
+															  out_generationResult.structLayouts.emplace_back(std::move(layout));
+														  }
+													  });
 				}
 
 				return out_generationResult;
@@ -60,22 +107,38 @@ void CodeGenManager::processFiles(FileParserType& fileParser, CodeGenUnitType& c
 			//Parse files
 			//For multiple iterations on a same file, the parsing task depends on the previous generation task for the same file
 			parsingTask = _threadPool.submitTask(std::string("Parsing ") + std::to_string(i), parsingTaskLambda);
+			parsingTask->setDescription(file.string());
 
 			//Generate code
 			generationTasks.emplace_back(_threadPool.submitTask(std::string("Generation ") + std::to_string(i), generationTaskLambda, { parsingTask }));
+			generationTasks.back()->setDescription(file.string());
 		}
 
+		TaskTracer::TimePoint iterationStart = TaskTracer::Clock::now();
+
 		//Wait for this iteration to complete before continuing any further
 		//(an iteration N depends on the iteration N - 1)
 		_threadPool.setIsRunning(true);
 		_threadPool.joinWorkers();
+
+		if (taskTracer != nullptr)
+		{
+			taskTracer->recordEvent("Iteration " + std::to_string(i), "CodeGenManager", "", iterationStart, TaskTracer::Clock::now());
+		}
 	}
 
+	TaskTracer::TimePoint mergeStart = TaskTracer::Clock::now();
+
 	//Merge all generation results together
 	for (std::shared_ptr<TaskBase>& task : generationTasks)
 	{
 		out_genResult.mergeResult(TaskHelper::getResult<CodeGenResult>(task.get()));
 	}
+
+	if (taskTracer != nullptr)
+	{
+		taskTracer->recordEvent("Merge results", "CodeGenManager", "", mergeStart, TaskTracer::Clock::now());
+	}
 }
 
 template <typename FileParserType, typename CodeGenUnitType>
@@ -100,7 +163,19 @@ CodeGenResult CodeGenManager::run(FileParserType& fileParser, CodeGenUnitType& c
 	{
 		//Start timer here
 		auto				start			= std::chrono::high_resolution_clock::now();
-		std::set<fs::path>	filesToProcess	= identifyFilesToProcess(codeGenUnit, genResult, forceRegenerateAll);
+
+		_cancellationToken.reset();
+		_threadPool.setTaskTracer(taskTracer);
+
+		TaskTracer::TimePoint	scanStart		= TaskTracer::Clock::now();
+		std::set<fs::path>		filesToProcess	= identifyFilesToProcess(codeGenUnit, genResult, forceRegenerateAll);
+
+		genResult.scanDuration = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - start).count();
+
+		if (taskTracer != nullptr)
+		{
+			taskTracer->recordEvent("Scan", "CodeGenManager", "", scanStart, TaskTracer::Clock::now());
+		}
 
 		//Don't setup anything if there are no files to generate
 		if (filesToProcess.size() > 0u)
@@ -109,10 +184,23 @@ CodeGenResult CodeGenManager::run(FileParserType& fileParser, CodeGenUnitType& c
 			//parsingSettings can't be nullptr since it has been checked in the checkGenerationSetup call.
 			fileParser.getSettings().init(logger);
 
+			//Only compute the entity data the registered modules read
+			fileParser.getSettings().parsedData = codeGenUnit.getRequiredParsedData();
+
+			if (settings.shouldAnalyzeStructLayouts)
+			{
+				fileParser.getSettings().parsedData = fileParser.getSettings().parsedData | EParsedData::TypeLayout;
+			}
+
 			generateMacrosFile(fileParser.getSettings(), codeGenUnit.getSettings()->getOutputDirectory());
 
 			//Start files processing
 			processFiles(fileParser, codeGenUnit, filesToProcess, genResult);
+
+			if (settings.shouldAnalyzeStructLayouts)
+			{
+				logStructLayoutWarnings(genResult);
+			}
 		}
 
 		genResult.duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count() * 0.001f;
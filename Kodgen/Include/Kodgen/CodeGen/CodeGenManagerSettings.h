@@ -12,6 +12,7 @@
 
 #include "Kodgen/Misc/Settings.h"
 #include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
 
 namespace kodgen
 {
@@ -132,7 +133,28 @@ namespace kodgen
 			void			loadIgnoredDirectories(toml::value const&	generationSettings,
 												   ILogger*				logger)					noexcept;
 
+			/**
+			*	@brief Load the shouldAnalyzeStructLayouts and structLayoutPaddingWarningThreshold settings from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadStructLayoutSettings(toml::value const&	generationSettings,
+													 ILogger*			logger)					noexcept;
+
 		public:
+			/**
+			*	Should the memory layout of parsed structs/classes be analyzed?
+			*	The layouts are returned in CodeGenResult::structLayouts and layouts with issues are logged as warnings.
+			*/
+			bool	shouldAnalyzeStructLayouts				= false;
+
+			/**
+			*	Number of padding bytes from which a struct/class layout is logged as a warning.
+			*	Structs/classes with fields straddling cache lines are logged whatever their padding.
+			*/
+			uint32	structLayoutPaddingWarningThreshold	= 8u;
+
 			/**
 			*	@brief	Add a file to the list of processed files.
 			*			If the path is invalid, doesn't exist, is not a file, or is already in the list, nothing happens.
@@ -13,6 +13,7 @@
 #include "Kodgen/Misc/ICloneable.h"
 #include "Kodgen/CodeGen/ICodeGenerator.h"
 #include "Kodgen/CodeGen/ETraversalBehaviour.h"
+#include "Kodgen/Parsing/EParsedData.h"
 
 namespace kodgen
 {
@@ -76,6 +77,20 @@ namespace kodgen
 			bool	removePropertyCodeGen(PropertyCodeGen const& propertyCodeGen)	noexcept;
 
 		public:
+			/**
+			*	@brief	Templated implementation of callVisitorOnEntity, usable with any visitor without wrapping it in a std::function.
+			* 
+			*	@param entity	The entity provided to the visitor.
+			*	@param env		The environment provided to the visitor.
+			*	@param visitor	The visitor to run. Must be callable as ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*).
+			* 
+			*	@return	The value returned from the visitor call.
+			*/
+			template <typename Visitor>
+			ETraversalBehaviour						visitEntity(EntityInfo const&	entity,
+																CodeGenEnv&			env,
+																Visitor&			visitor)						noexcept;
+
 			/**
 			*	@brief	Generate code using the provided environment as input.
 			* 
@@ -94,6 +109,15 @@ namespace kodgen
 			*/
 			virtual int32							getGenerationOrder()							const	noexcept override;
 
+			/**
+			*	@brief	Get the optional entity data this module reads during code generation.
+			*			Data no registered module requires is not computed by the parser.
+			*			Defaults to EParsedData::All so that modules which don't override this method keep working.
+			*
+			*	@return The data required by this module.
+			*/
+			virtual EParsedData						getRequiredParsedData()							const	noexcept;
+
 			/**
 			*	@brief Getter for _propertyCodeGenerators field.
 			*
@@ -101,4 +125,6 @@ namespace kodgen
 			*/
 			std::vector<PropertyCodeGen*> const&	getPropertyCodeGenerators()						const	noexcept;
 	};
+
+	#include "Kodgen/CodeGen/CodeGenModule.inl"
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename Visitor>
+ETraversalBehaviour CodeGenModule::visitEntity(EntityInfo const& entity, CodeGenEnv& env, Visitor& visitor) noexcept
+{
+	return visitor(*this, entity, env, nullptr);
+}
\ No newline at end of file
@@ -8,7 +8,11 @@
 #pragma once
 
 #include <vector>
+#include <string>
+#include <utility>	//std::pair
 
+#include "Kodgen/CodeGen/FileTimings.h"
+#include "Kodgen/CodeGen/StructLayout.h"
 #include "Kodgen/Misc/Filesystem.h"
 
 namespace kodgen
@@ -20,16 +24,31 @@ namespace kodgen
 			*	This boolean is set to true if the whole generation process has been completed successfully,
 			*	and false otherwise. Make sure to check the logs to get some hints about the failure cause.
 			*/
-			bool					completed	= false;
+			bool										completed				= false;
 
 			/** Time elapsed (in seconds) to discover files to parse, parse, generate and collect results of all files. */
-			float					duration	= 0.0f;
+			float										duration				= 0.0f;
+
+			/** Time elapsed (in seconds) to discover the files to process, up-to-date checks included. */
+			float										scanDuration			= 0.0f;
+
+			/** Time elapsed (in seconds) in CodeGenUnit::isUpToDate calls. */
+			float										upToDateCheckDuration	= 0.0f;
 
 			/** List of paths to files that have been parsed and got their metadata regenerated. */
-			std::vector<fs::path>	parsedFiles;
+			std::vector<fs::path>						parsedFiles;
 
 			/** List of paths to files which metadata are up-to-date. */
-			std::vector<fs::path>	upToDateFiles;
+			std::vector<fs::path>						upToDateFiles;
+
+			/** List of paths to files which parsing exceeded ParsingSettings::parseTimeout, with the time elapsed (in seconds) before they were abandoned. */
+			std::vector<std::pair<fs::path, float>>		timedOutFiles;
+
+			/** Per-phase timings of each processed file (one entry per file and per iteration). */
+			std::vector<FileTimings>					fileTimings;
+
+			/** Layout of the parsed structs/classes, only filled if CodeGenManagerSettings::shouldAnalyzeStructLayouts is set. */
+			std::vector<StructLayout>					structLayouts;
 
 			/**
 			*	@brief Merge a result to this result.
@@ -37,6 +56,24 @@ namespace kodgen
 			*	@param otherResult	The result to merge with this result.
 			*						After the call, otherResult state is UB.
 			*/
-			void mergeResult(CodeGenResult&& otherResult)	noexcept;
+			void		mergeResult(CodeGenResult&& otherResult)	noexcept;
+
+			/**
+			*	@brief	Serialize the timings of this result to JSON.
+			*			The output contains the run-level phases, the p50/p90/p99/max/total of each per-file phase
+			*			(code generators included), and the detailed timings of each file.
+			* 
+			*	@return The JSON string.
+			*/
+			std::string	getTimingsAsJson()					const	noexcept;
+
+			/**
+			*	@brief	Serialize the struct layouts of this result to JSON.
+			*			The output contains the size, alignment, fields, padding holes, cache line straddling fields
+			*			and suggested field order of each analyzed struct/class.
+			*
+			*	@return The JSON string.
+			*/
+			std::string	getStructLayoutsAsJson()			const	noexcept;
 	};
 }
\ No newline at end of file
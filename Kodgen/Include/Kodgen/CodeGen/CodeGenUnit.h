@@ -8,13 +8,21 @@
 #pragma once
 
 #include <vector>
+#include <array>
+#include <unordered_map>
 #include <functional>	//std::function
+#include <algorithm>	//std::find
+#include <chrono>
+#include <cassert>
 
 #include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
 #include "Kodgen/CodeGen/ETraversalBehaviour.h"
 #include "Kodgen/CodeGen/CodeGenEnv.h"
 #include "Kodgen/CodeGen/CodeGenUnitSettings.h"
 #include "Kodgen/CodeGen/CodeGenModule.h"
+#include "Kodgen/CodeGen/PropertyCodeGen.h"
+#include "Kodgen/CodeGen/CodeGenHelpers.h"
+#include "Kodgen/CodeGen/FileTimings.h"
 #include "Kodgen/Misc/ILogger.h"
 #include "Kodgen/Misc/Filesystem.h"
 #include "Kodgen/Misc/FundamentalTypes.h"
@@ -32,6 +40,27 @@ namespace kodgen
 			*/
 			bool						_isCopy	= false;
 
+			/** All code generators of the registered modules (modules and their property code generators), sorted by ascending generation order. */
+			std::vector<ICodeGenerator*>								_sortedCodeGenerators;
+
+			/** Eligible entity mask of each code generator of _sortedCodeGenerators. */
+			std::vector<EEntityType>									_eligibleEntityMasks;
+
+			/** For each entity type, indices in _sortedCodeGenerators of the eligible code generators which are not bound to a property. */
+			std::array<std::vector<uint32>, entityTypesCount>			_unboundCodeGeneratorsPerEntityType;
+
+			/** For each property name, indices in _sortedCodeGenerators of the PropertyCodeGens bound to that property. */
+			std::unordered_map<std::string, std::vector<uint32>>		_propertyCodeGeneratorsPerName;
+
+			/** Buffer returned by getEligibleCodeGenerators for entities having properties. */
+			std::vector<uint32>											_eligibleCodeGenerators;
+
+			/** For each code generator of _sortedCodeGenerators, the abort value it returned during the current traversal, or ETraversalBehaviour::Recurse. */
+			std::vector<ETraversalBehaviour>							_codeGeneratorAbortResults;
+
+			/** Number of code generators which aborted the current traversal. */
+			size_t														_abortedCodeGeneratorsCount = 0u;
+
 			/**
 			*	@brief Insert a code generator to a sorted vector ordered by generation order.
 			* 
@@ -48,116 +77,169 @@ namespace kodgen
 			void						clearGenerationModules()																				noexcept;
 
 			/**
-			*	@brief Iterate and execute recursively a visitor function on each parsed entity/registered module pair.
+			*	@brief	Rebuild _sortedCodeGenerators and the code generator lookup tables from the registered modules.
+			*			Must be called each time a module is added or removed.
+			*/
+			void						refreshCodeGenerators()																					noexcept;
+
+			/**
+			*	@brief	Get the code generators to offer the provided entity to: generators which are not bound to a property
+			*			and eligible to the entity type, and PropertyCodeGens eligible to the entity type and bound to one of the entity properties.
 			* 
-			*	@param visitor	Visitor function to execute on all traversed entities.
-			*	@param env		Generation environment structure.
+			*	@param entity The entity.
+			* 
+			*	@return The indices of the code generators in _sortedCodeGenerators, sorted by ascending generation order.
+			*/
+			std::vector<uint32> const&	getEligibleCodeGenerators(EntityInfo const& entity)													noexcept;
+
+			/**
+			*	@brief	Iterate once over all parsed entities and execute a visitor function on each eligible entity/code generator pair.
+			*			On each entity, code generators run in ascending generation order.
+			*			A code generator aborting the traversal only stops itself, the other code generators keep running on all entities.
+			* 
+			*	@param visitor			Visitor function to execute on all traversed entities.
+			*							Must be callable as ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*).
+			*	@param env				Generation environment structure.
+			*	@param inout_durations	Time (in seconds) spent in each code generator. Must be the same size as _sortedCodeGenerators.
+			* 
+			*	@return ETraversalBehaviour::AbortWithFailure if any code generator aborted with failure, else ETraversalBehaviour::Recurse.
+			*/
+			template <typename Visitor>
+			ETraversalBehaviour			foreachCodeGenEntityPair(Visitor&				visitor,
+																 CodeGenEnv&			env,
+																 std::vector<float>&	inout_durations)										noexcept;
+
+			/**
+			*	@brief	Iterate and execute recursively a visitor function on all the entities of the parsed file with all eligible code generators.
 			* 
-			*	@return ETraversalBehaviour::Recurse if the traversal completed successfully.
-			*			ETraversalBehaviour::AbortWithSuccess if the traversal was aborted prematurely without error.
-			*			ETraversalBehaviour::AbortWithFailure if the traversal was aborted prematurely with an error.
+			*	@param parsingResult	Result of the parsed file.
+			*	@param visitor			Visitor function to execute on all traversed entities.
+			*	@param env				Generation environment structure.
+			*	@param inout_durations	Time (in seconds) spent in each code generator.
+			* 
+			*	@return ETraversalBehaviour::AbortWithSuccess if all code generators aborted, else ETraversalBehaviour::Recurse.
 			*/
-			ETraversalBehaviour			foreachCodeGenEntityPair(std::function<ETraversalBehaviour(ICodeGenerator&,
-																								   EntityInfo const&,
-																								   CodeGenEnv&,
-																								   void const*)>		visitor,
-																 CodeGenEnv&											env)					noexcept;
+			template <typename Visitor>
+			ETraversalBehaviour			foreachCodeGenEntityPairInFile(FileParsingResult const&	parsingResult,
+																	   Visitor&					visitor,
+																	   CodeGenEnv&				env,
+																	   std::vector<float>&		inout_durations)								noexcept;
+
+			/**
+			*	@brief	Execute the visitor function on an entity with all eligible and active code generators.
+			* 
+			*	@param entity						Entity to visit.
+			*	@param visitor						Visitor function to execute.
+			*	@param env							Generation environment structure.
+			*	@param inout_activeCodeGenerators	For each code generator, non-zero if it still visits the siblings of the entity.
+			*										Code generators returning ETraversalBehaviour::Break are deactivated.
+			*										Code generators aborting are deactivated for the rest of the traversal.
+			*	@param out_nestedCodeGenerators		For each code generator, set to non-zero if it should visit the entities nested in entity.
+			*										Can be nullptr if the entity can't contain nested entities.
+			*	@param inout_durations				Time (in seconds) spent in each code generator.
+			* 
+			*	@return ETraversalBehaviour::AbortWithSuccess if all code generators aborted, else ETraversalBehaviour::Recurse.
+			*/
+			template <typename Visitor>
+			ETraversalBehaviour			callVisitorOnEntity(EntityInfo const&		entity,
+															Visitor&				visitor,
+															CodeGenEnv&				env,
+															std::vector<uint8>&		inout_activeCodeGenerators,
+															std::vector<uint8>*		out_nestedCodeGenerators,
+															std::vector<float>&		inout_durations)											noexcept;
+
+			/**
+			*	@brief Check if any of the active code generators is eligible to the provided entity types.
+			* 
+			*	@param activeCodeGenerators	For each code generator, non-zero if it is active.
+			*	@param entityTypes			Mask of entity types.
+			* 
+			*	@return true if at least one active code generator is eligible to one of the provided entity types, else false.
+			*/
+			bool						isAnyCodeGeneratorEligible(std::vector<uint8> const&	activeCodeGenerators,
+																   EEntityType					entityTypes)								const	noexcept;
 
 			/**
 			*	@brief	Iterate and execute recursively a visitor function on a namespace and
-			*			all its nested entities/registered module pair.
+			*			all its nested entities with all eligible code generators.
 			* 
-			*	@param namespace_	Namespace to iterate on.
-			*	@param visitor		Visitor function to execute on all traversed entities.
-			*	@param env			Generation environment structure.
+			*	@param namespace_					Namespace to iterate on.
+			*	@param visitor						Visitor function to execute on all traversed entities.
+			*	@param env							Generation environment structure.
+			*	@param inout_activeCodeGenerators	For each code generator, non-zero if it still visits the siblings of the namespace.
+			*	@param inout_durations				Time (in seconds) spent in each code generator.
 			* 
-			*	@return ETraversalBehaviour::Recurse if the traversal completed successfully.
-			*			ETraversalBehaviour::AbortWithSuccess if the traversal was aborted prematurely without error.
-			*			ETraversalBehaviour::AbortWithFailure if the traversal was aborted prematurely with an error.
+			*	@return ETraversalBehaviour::AbortWithSuccess if all code generators aborted, else ETraversalBehaviour::Recurse.
 			*/
-			ETraversalBehaviour			foreachCodeGenEntityPairInNamespace(ICodeGenerator&										codeGenerator,
-																			NamespaceInfo const&								namespace_,
-																			CodeGenEnv&											env,
-																			std::function<ETraversalBehaviour(ICodeGenerator&,
-																											  EntityInfo const&,
-																											  CodeGenEnv&,
-																											  void const*)>		visitor)		noexcept;
+			template <typename Visitor>
+			ETraversalBehaviour			foreachCodeGenEntityPairInNamespace(NamespaceInfo const&	namespace_,
+																			Visitor&				visitor,
+																			CodeGenEnv&				env,
+																			std::vector<uint8>&		inout_activeCodeGenerators,
+																			std::vector<float>&		inout_durations)							noexcept;
 
 			/**
 			*	@brief	Iterate and execute recursively a visitor function on a struct or class and
-			*			all its nested entities/registered module pair.
+			*			all its nested entities with all eligible code generators.
 			* 
-			*	@param struct_	Struct/class to iterate on.
-			*	@param visitor	Visitor function to execute on all traversed entities.
-			*	@param env		Generation environment structure.
+			*	@param struct_						Struct/class to iterate on.
+			*	@param visitor						Visitor function to execute on all traversed entities.
+			*	@param env							Generation environment structure.
+			*	@param inout_activeCodeGenerators	For each code generator, non-zero if it still visits the siblings of the struct/class.
+			*	@param inout_durations				Time (in seconds) spent in each code generator.
 			* 
-			*	@return ETraversalBehaviour::Recurse if the traversal completed successfully.
-			*			ETraversalBehaviour::AbortWithSuccess if the traversal was aborted prematurely without error.
-			*			ETraversalBehaviour::AbortWithFailure if the traversal was aborted prematurely with an error.
+			*	@return ETraversalBehaviour::AbortWithSuccess if all code generators aborted, else ETraversalBehaviour::Recurse.
 			*/
-			ETraversalBehaviour			foreachCodeGenEntityPairInStruct(ICodeGenerator&										codeGenerator,
-																		 StructClassInfo const&									struct_,
-																		 CodeGenEnv&											env,
-																		 std::function<ETraversalBehaviour(ICodeGenerator&,
-																		 								   EntityInfo const&,
-																		 								   CodeGenEnv&,
-																		 								   void const*)>		visitor)		noexcept;
+			template <typename Visitor>
+			ETraversalBehaviour			foreachCodeGenEntityPairInStruct(StructClassInfo const&	struct_,
+																		 Visitor&				visitor,
+																		 CodeGenEnv&			env,
+																		 std::vector<uint8>&	inout_activeCodeGenerators,
+																		 std::vector<float>&	inout_durations)								noexcept;
 
 			/**
-			*	@brief Iterate and execute recursively a visitor function on an enum and all its nested entities.
+			*	@brief Iterate and execute recursively a visitor function on an enum and all its nested entities with all eligible code generators.
 			* 
-			*	@param enum_	Enum to iterate on.
-			*	@param visitor	Visitor function to execute on all traversed entities.
-			*	@param env		Generation environment structure.
+			*	@param enum_						Enum to iterate on.
+			*	@param visitor						Visitor function to execute on all traversed entities.
+			*	@param env							Generation environment structure.
+			*	@param inout_activeCodeGenerators	For each code generator, non-zero if it still visits the siblings of the enum.
+			*	@param inout_durations				Time (in seconds) spent in each code generator.
 			* 
-			*	@return ETraversalBehaviour::Recurse if the traversal completed successfully.
-			*			ETraversalBehaviour::AbortWithSuccess if the traversal was aborted prematurely without error.
-			*			ETraversalBehaviour::AbortWithFailure if the traversal was aborted prematurely with an error.
+			*	@return ETraversalBehaviour::AbortWithSuccess if all code generators aborted, else ETraversalBehaviour::Recurse.
 			*/
-			ETraversalBehaviour			foreachCodeGenEntityPairInEnum(ICodeGenerator&										codeGenerator,
-																	   EnumInfo const&										enum_,
-																	   CodeGenEnv&											env,
-																	   std::function<ETraversalBehaviour(ICodeGenerator&,
-																										 EntityInfo const&,
-																										 CodeGenEnv&,
-																										 void const*)>		visitor)			noexcept;
+			template <typename Visitor>
+			ETraversalBehaviour			foreachCodeGenEntityPairInEnum(EnumInfo const&			enum_,
+																	   Visitor&					visitor,
+																	   CodeGenEnv&				env,
+																	   std::vector<uint8>&		inout_activeCodeGenerators,
+																	   std::vector<float>&		inout_durations)								noexcept;
 
 			/**
 			*	@brief Call ICodeGenerator::initialGenerateCode on all provided code generators.
 			* 
 			*	@param codeGenerators	List of code generators that should call ICodeGenerator::initialGenerateCode.
 			*	@param env				The environment structure.
+			*	@param inout_durations	Time (in seconds) spent in each code generator. Must be the same size as codeGenerators.
 			* 
 			*	@return A combined value of all the ICodeGenerator::initialGeneratorCode calls.
 			*/
 			bool					initialGenerateCodeInternal(std::vector<ICodeGenerator*> const&	codeGenerators,
-																CodeGenEnv&							env)										noexcept;
+																CodeGenEnv&							env,
+																std::vector<float>&					inout_durations)							noexcept;
 
 			/**
 			*	@brief Call ICodeGenerator::finalGenerateCode on all provided code generators.
 			* 
 			*	@param codeGenerators	List of code generators that should call ICodeGenerator::finalGenerateCode.
 			*	@param env				The environment structure.
+			*	@param inout_durations	Time (in seconds) spent in each code generator. Must be the same size as codeGenerators.
 			* 
 			*	@return A combined value of all the ICodeGenerator::finalGeneratorCode calls.
 			*/
 			bool					finalGenerateCodeInternal(std::vector<ICodeGenerator*> const&	codeGenerators,
-															  CodeGenEnv&							env)										noexcept;
-
-			/**
-			*	@brief	Method called on each entity when CodeGenUnit::generateCode is called.
-			* 
-			*	@param codeGenerator	The code generator to run for the entity.
-			*	@param entity			The entity for which the generate generates code.
-			*	@param env				The environment structure.
-			*	@param data				Opaque data forwarded to the codeGenerator.generateCode call.
-			* 
-			*	@return A combined value of all the codeGenerator.generateCode calls.
-			*/
-			ETraversalBehaviour		generateCodeForEntityInternal(ICodeGenerator&	codeGenerator,
-																  EntityInfo const&	entity,
-																  CodeGenEnv&		env,
-																  void const*		data)														noexcept;
+															  CodeGenEnv&							env,
+															  std::vector<float>&					inout_durations)							noexcept;
 
 		protected:
 			/** Settings used for code generation. */
@@ -177,6 +259,36 @@ namespace kodgen
 																					 CodeGenEnv&,
 																					 std::string&)>		generate)	noexcept	= 0;
 
+			/**
+			*	@brief	Statically dispatched version of generateCodeForEntity, called by generateCodeInternal.
+			*			The default implementation forwards to the generateCodeForEntity virtual method.
+			*			Child units can hide this method to have the whole generation inlined (see generateCodeInternal).
+			*
+			*	@param entity	Target entity for this code generation pass.
+			*	@param env		Generation environment structure.
+			*	@param generate	Function to call with the string the generated code should be appended to.
+			*					Callable as void(EntityInfo const&, CodeGenEnv&, std::string&).
+			*/
+			template <typename GenerateFunc>
+			void							generateCodeForEntityInternal(EntityInfo const&	entity,
+																		  CodeGenEnv&		env,
+																		  GenerateFunc&		generate)				noexcept;
+
+			/**
+			*	@brief	Implementation of generateCode, templated on the concrete CodeGenUnit type.
+			*			The entities are traversed with a statically dispatched visitor calling CodeGenUnitType::generateCodeForEntityInternal,
+			*			so that the traversal doesn't go through any std::function when CodeGenUnitType hides generateCodeForEntityInternal.
+			*			CodeGenUnitType must be this class or a child class befriending CodeGenUnit.
+			* 
+			*	@param parsingResult	Result of a file parsing used to generate code.
+			*	@param out_timings		Optional timings to fill with the time spent in each code generator and in postGenerateCode. Can be nullptr.
+			* 
+			*	@return true if preGenerateCode, foreachModuleEntityPair and postGenerateCode calls have succeeded, else false.
+			*/
+			template <typename CodeGenUnitType>
+			bool							generateCodeInternal(FileParsingResult const&	parsingResult,
+																 FileTimings*				out_timings)					noexcept;
+
 			/**
 			*	@brief	Execute the codeGenModule->initialGenerateCode method with the given environment.
 			*			The method is made virtual pure to let the implementation control in which string the generated code should be appended.
@@ -248,11 +360,11 @@ namespace kodgen
 															fs::path const& referenceFile)					const	noexcept;
 
 			/**
-			*	@brief Compute the list of all generators nested in this CodeGenUnit sorted by ascending generation order.
+			*	@brief Get the list of all generators nested in this CodeGenUnit sorted by ascending generation order.
 			* 
 			*	@return The list of sorted code generators.
 			*/
-			std::vector<ICodeGenerator*>	getSortedCodeGenerators()										const	noexcept;
+			std::vector<ICodeGenerator*> const&	getSortedCodeGenerators()									const	noexcept;
 
 		public:
 			/** Logger used to issue logs from this CodeGenUnit. */
@@ -290,13 +402,16 @@ namespace kodgen
 			*			ex: If preGenerateCode returns false, both foreachModuleEntityPair and postGenerateCode calls will be skipped.
 			*			
 			*	@param parsingResult	Result of a file parsing used to generate code.
+			*	@param out_timings		Optional timings to fill with the time spent in each code generator and in postGenerateCode. Can be nullptr.
 			* 
 			*	@return true if preGenerateCode, foreachModuleEntityPair and postGenerateCode calls have succeeded, else false.
 			*/
-			bool						generateCode(FileParsingResult const& parsingResult)	noexcept;
+			bool						generateCode(FileParsingResult const&	parsingResult,
+													 FileTimings*				out_timings = nullptr)	noexcept;
 
 			/**
-			*	@brief Add a module to the internal list of generation modules.
+			*	@brief	Add a module to the internal list of generation modules.
+			*			The module property code generators must be registered before the module is added.
 			* 
 			*	@param generationModule The generation module to add.
 			*/
@@ -323,6 +438,11 @@ namespace kodgen
 			*/
 			uint8								getIterationCount()						const	noexcept;
 
+			/**
+			*	@brief Get the union of the optional entity data required by all registered modules.
+			*/
+			EParsedData							getRequiredParsedData()					const	noexcept;
+
 			/**
 			*	@brief Getter for _generationModules field.
 			* 
@@ -333,4 +453,6 @@ namespace kodgen
 			CodeGenUnit&	operator=(CodeGenUnit const&)	noexcept;
 			CodeGenUnit&	operator=(CodeGenUnit&&)		= default;
 	};
+
+	#include "Kodgen/CodeGen/CodeGenUnit.inl"
 }
\ No newline at end of file
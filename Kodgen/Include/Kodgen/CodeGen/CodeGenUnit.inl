@@ -0,0 +1,408 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#define HANDLE_ABORT_TRAVERSAL_RESULT(result)																		\
+	if (result == ETraversalBehaviour::AbortWithFailure || result == ETraversalBehaviour::AbortWithSuccess)	\
+	{																											\
+		return result;																							\
+	}
+
+template <typename CodeGenUnitType>
+bool CodeGenUnit::generateCodeInternal(FileParsingResult const& parsingResult, FileTimings* out_timings) noexcept
+{
+	//TODO: Should probably use std::unique_ptr here instead of a raw pointer to be exception-safe
+	CodeGenEnv* env = createCodeGenEnv();
+	
+	//If you assert/crash here, means the createCodeGenEnv method returned nullptr
+	//Check the implementation in the CodeGenUnit you use.
+	assert(env != nullptr);
+
+	//Pre-generation step
+	bool result = preGenerateCode(parsingResult, *env);
+
+	//Generation step (per module/entity pair), runs only if the pre-generation step succeeded
+	if (result)
+	{
+		std::vector<ICodeGenerator*> const&	codeGenerators = getSortedCodeGenerators();
+		std::vector<float>					codeGenDurations(codeGenerators.size(), 0.0f);
+
+		//Call initialGenerateCode on all ICodeGenerators first
+		initialGenerateCodeInternal(codeGenerators, *env, codeGenDurations);
+
+		if (result)
+		{
+			//Iterate over each module and entity and generate code
+			auto visitor = [this](ICodeGenerator& codeGenerator, EntityInfo const& entity, CodeGenEnv& env, void const* data)
+			{
+				ETraversalBehaviour visitResult = CodeGenHelpers::leastPrioritizedTraversalBehaviour;
+
+				auto generateLambda = [&visitResult, &codeGenerator, data](EntityInfo const& entity, CodeGenEnv& env, std::string& inout_result)
+				{
+					visitResult = CodeGenHelpers::combineTraversalBehaviours(visitResult, codeGenerator.generateCodeForEntity(entity, env, inout_result, data));
+				};
+
+				//visitResult will be altered when generateLambda will be called from the CodeGenUnitType::generateCodeForEntityInternal implementation
+				static_cast<CodeGenUnitType*>(this)->generateCodeForEntityInternal(entity, env, generateLambda);
+
+				return visitResult;
+			};
+
+			result &= foreachCodeGenEntityPair(visitor, *env, codeGenDurations) != ETraversalBehaviour::AbortWithFailure;
+
+			if (result)
+			{
+				//Final call to generate code with a nullptr entity
+				finalGenerateCodeInternal(codeGenerators, *env, codeGenDurations);
+
+				//Post-generation step, runs only if all previous steps succeeded
+				if (result)
+				{
+					auto writeStart = std::chrono::steady_clock::now();
+
+					result &= postGenerateCode(*env);
+
+					if (out_timings != nullptr)
+					{
+						out_timings->writeDuration = std::chrono::duration<float>(std::chrono::steady_clock::now() - writeStart).count();
+					}
+				}
+			}
+		}
+
+		if (out_timings != nullptr)
+		{
+			out_timings->codeGenDurations.reserve(codeGenerators.size());
+
+			for (size_t i = 0u; i < codeGenerators.size(); i++)
+			{
+				out_timings->codeGenDurations.emplace_back(codeGenerators[i]->getName(), codeGenDurations[i]);
+			}
+		}
+	}
+
+	delete env;
+
+	return result;
+}
+
+template <typename GenerateFunc>
+void CodeGenUnit::generateCodeForEntityInternal(EntityInfo const& entity, CodeGenEnv& env, GenerateFunc& generate) noexcept
+{
+	generateCodeForEntity(entity, env, generate);
+}
+
+template <typename Visitor>
+ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPair(Visitor& visitor,
+															CodeGenEnv& env, std::vector<float>& inout_durations) noexcept
+{
+	assert(_sortedCodeGenerators.size() == inout_durations.size());
+
+	_codeGeneratorAbortResults.assign(_sortedCodeGenerators.size(), ETraversalBehaviour::Recurse);
+	_abortedCodeGeneratorsCount = 0u;
+
+	foreachCodeGenEntityPairInFile(*env.getFileParsingResult(), visitor, env, inout_durations);
+
+	return (std::find(_codeGeneratorAbortResults.cbegin(), _codeGeneratorAbortResults.cend(), ETraversalBehaviour::AbortWithFailure) != _codeGeneratorAbortResults.cend()) ?
+				ETraversalBehaviour::AbortWithFailure : ETraversalBehaviour::Recurse;
+}
+
+template <typename Visitor>
+ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPairInFile(FileParsingResult const& parsingResult, Visitor& visitor,
+																CodeGenEnv& env, std::vector<float>& inout_durations) noexcept
+{
+	std::vector<uint8>		rootCodeGenerators(_sortedCodeGenerators.size(), 1u);
+	std::vector<uint8>		activeCodeGenerators;
+	ETraversalBehaviour		result;
+
+	//Each collection restarts with all code generators, ETraversalBehaviour::Break only skipping the remaining siblings of the same collection
+	activeCodeGenerators = rootCodeGenerators;
+
+	for (NamespaceInfo const& namespace_ : parsingResult.namespaces)
+	{
+		result = foreachCodeGenEntityPairInNamespace(namespace_, visitor, env, activeCodeGenerators, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = rootCodeGenerators;
+
+	for (StructClassInfo const& struct_ : parsingResult.structs)
+	{
+		result = foreachCodeGenEntityPairInStruct(struct_, visitor, env, activeCodeGenerators, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = rootCodeGenerators;
+
+	for (StructClassInfo const& class_ : parsingResult.classes)
+	{
+		result = foreachCodeGenEntityPairInStruct(class_, visitor, env, activeCodeGenerators, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = rootCodeGenerators;
+
+	for (EnumInfo const& enum_ : parsingResult.enums)
+	{
+		result = foreachCodeGenEntityPairInEnum(enum_, visitor, env, activeCodeGenerators, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = rootCodeGenerators;
+
+	for (VariableInfo const& variable : parsingResult.variables)
+	{
+		result = callVisitorOnEntity(variable, visitor, env, activeCodeGenerators, nullptr, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = rootCodeGenerators;
+
+	for (FunctionInfo const& function : parsingResult.functions)
+	{
+		result = callVisitorOnEntity(function, visitor, env, activeCodeGenerators, nullptr, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	return ETraversalBehaviour::Recurse;
+}
+
+template <typename Visitor>
+ETraversalBehaviour CodeGenUnit::callVisitorOnEntity(EntityInfo const& entity, Visitor& visitor,
+													 CodeGenEnv& env, std::vector<uint8>& inout_activeCodeGenerators, std::vector<uint8>* out_nestedCodeGenerators, std::vector<float>& inout_durations) noexcept
+{
+	//Code generators which are not eligible to the entity keep traversing nested entities
+	if (out_nestedCodeGenerators != nullptr)
+	{
+		*out_nestedCodeGenerators = inout_activeCodeGenerators;
+	}
+
+	//Code generators are reached through the virtual callVisitorOnEntity so that overrides are honoured.
+	//The std::function only references the visitor, so building it doesn't allocate
+	std::function<ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*)> visitorFunction = std::ref(visitor);
+
+	for (uint32 index : getEligibleCodeGenerators(entity))
+	{
+		if (inout_activeCodeGenerators[index] == 0u || _codeGeneratorAbortResults[index] != ETraversalBehaviour::Recurse)
+		{
+			continue;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+
+		env._codeGeneratorIndex = index;
+
+		ETraversalBehaviour result = _sortedCodeGenerators[index]->callVisitorOnEntity(entity, env, visitorFunction);
+
+		inout_durations[index] += std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+		switch (result)
+		{
+			case ETraversalBehaviour::Recurse:
+				break;
+
+			case ETraversalBehaviour::Break:
+				inout_activeCodeGenerators[index] = 0u;
+				[[fallthrough]];
+
+			case ETraversalBehaviour::Continue:
+				if (out_nestedCodeGenerators != nullptr)
+				{
+					(*out_nestedCodeGenerators)[index] = 0u;
+				}
+				break;
+
+			default:
+				//AbortWithSuccess
+				//AbortWithFailure
+				//Only this code generator stops, the others keep running so that all their errors are reported
+				_codeGeneratorAbortResults[index]	= result;
+				inout_activeCodeGenerators[index]	= 0u;
+
+				if (out_nestedCodeGenerators != nullptr)
+				{
+					(*out_nestedCodeGenerators)[index] = 0u;
+				}
+
+				//Stop the whole traversal once no code generator is left
+				if (++_abortedCodeGeneratorsCount == _sortedCodeGenerators.size())
+				{
+					return ETraversalBehaviour::AbortWithSuccess;
+				}
+				break;
+		}
+	}
+
+	return ETraversalBehaviour::Recurse;
+}
+
+template <typename Visitor>
+ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPairInNamespace(NamespaceInfo const& namespace_, Visitor& visitor,
+																	 CodeGenEnv& env, std::vector<uint8>& inout_activeCodeGenerators, std::vector<float>& inout_durations) noexcept
+{
+	std::vector<uint8> nestedCodeGenerators;
+
+	//Execute the visitor function on the current namespace
+	ETraversalBehaviour result = callVisitorOnEntity(namespace_, visitor, env, inout_activeCodeGenerators, &nestedCodeGenerators, inout_durations);
+
+	if (result != ETraversalBehaviour::Recurse || !isAnyCodeGeneratorEligible(nestedCodeGenerators, NamespaceInfo::nestedEntityTypes))
+	{
+		return result;
+	}
+
+	//Iterate and execute the provided visitor function recursively on all nested entities
+	std::vector<uint8> activeCodeGenerators = nestedCodeGenerators;
+
+	for (NamespaceInfo const& nestedNamespace : namespace_.namespaces)
+	{
+		result = foreachCodeGenEntityPairInNamespace(nestedNamespace, visitor, env, activeCodeGenerators, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = nestedCodeGenerators;
+
+	for (StructClassInfo const& struct_ : namespace_.structs)
+	{
+		result = foreachCodeGenEntityPairInStruct(struct_, visitor, env, activeCodeGenerators, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = nestedCodeGenerators;
+
+	for (StructClassInfo const& class_ : namespace_.classes)
+	{
+		result = foreachCodeGenEntityPairInStruct(class_, visitor, env, activeCodeGenerators, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = nestedCodeGenerators;
+
+	for (EnumInfo const& enum_ : namespace_.enums)
+	{
+		result = foreachCodeGenEntityPairInEnum(enum_, visitor, env, activeCodeGenerators, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = nestedCodeGenerators;
+
+	for (VariableInfo const& variable : namespace_.variables)
+	{
+		result = callVisitorOnEntity(variable, visitor, env, activeCodeGenerators, nullptr, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = nestedCodeGenerators;
+
+	for (FunctionInfo const& function : namespace_.functions)
+	{
+		result = callVisitorOnEntity(function, visitor, env, activeCodeGenerators, nullptr, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	return ETraversalBehaviour::Recurse;
+}
+
+template <typename Visitor>
+ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPairInStruct(StructClassInfo const& struct_, Visitor& visitor,
+																  CodeGenEnv& env, std::vector<uint8>& inout_activeCodeGenerators, std::vector<float>& inout_durations) noexcept
+{
+	std::vector<uint8> nestedCodeGenerators;
+
+	//Execute the visitor function on the current struct/class
+	ETraversalBehaviour result = callVisitorOnEntity(struct_, visitor, env, inout_activeCodeGenerators, &nestedCodeGenerators, inout_durations);
+
+	if (result != ETraversalBehaviour::Recurse || !isAnyCodeGeneratorEligible(nestedCodeGenerators, StructClassInfo::nestedEntityTypes))
+	{
+		return result;
+	}
+
+	//Iterate and execute the provided visitor function recursively on all nested entities
+	std::vector<uint8> activeCodeGenerators = nestedCodeGenerators;
+
+	for (std::shared_ptr<NestedStructClassInfo> const& nestedStruct : struct_.nestedStructs)
+	{
+		result = foreachCodeGenEntityPairInStruct(*nestedStruct, visitor, env, activeCodeGenerators, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = nestedCodeGenerators;
+
+	for (std::shared_ptr<NestedStructClassInfo> const& nestedClass : struct_.nestedClasses)
+	{
+		result = foreachCodeGenEntityPairInStruct(*nestedClass, visitor, env, activeCodeGenerators, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = nestedCodeGenerators;
+
+	for (NestedEnumInfo const& nestedEnum : struct_.nestedEnums)
+	{
+		result = foreachCodeGenEntityPairInEnum(nestedEnum, visitor, env, activeCodeGenerators, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = nestedCodeGenerators;
+
+	for (FieldInfo const& field : struct_.fields)
+	{
+		result = callVisitorOnEntity(field, visitor, env, activeCodeGenerators, nullptr, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+
+	activeCodeGenerators = nestedCodeGenerators;
+
+	for (MethodInfo const& method : struct_.methods)
+	{
+		result = callVisitorOnEntity(method, visitor, env, activeCodeGenerators, nullptr, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+	
+	return ETraversalBehaviour::Recurse;
+}
+
+template <typename Visitor>
+ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPairInEnum(EnumInfo const& enum_, Visitor& visitor,
+																CodeGenEnv& env, std::vector<uint8>& inout_activeCodeGenerators, std::vector<float>& inout_durations) noexcept
+{
+	std::vector<uint8> nestedCodeGenerators;
+
+	//Execute the visitor function on the current enum
+	ETraversalBehaviour result = callVisitorOnEntity(enum_, visitor, env, inout_activeCodeGenerators, &nestedCodeGenerators, inout_durations);
+
+	if (result != ETraversalBehaviour::Recurse || !isAnyCodeGeneratorEligible(nestedCodeGenerators, EnumInfo::nestedEntityTypes))
+	{
+		return result;
+	}
+
+	//Iterate and execute the provided visitor function recursively on all enum values
+	for (EnumValueInfo const& enumValue : enum_.enumValues)
+	{
+		result = callVisitorOnEntity(enumValue, visitor, env, nestedCodeGenerators, nullptr, inout_durations);
+
+		HANDLE_ABORT_TRAVERSAL_RESULT(result);
+	}
+	
+	return ETraversalBehaviour::Recurse;
+}
+
+#undef HANDLE_ABORT_TRAVERSAL_RESULT
\ No newline at end of file
@@ -0,0 +1,162 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <array>
+#include <concepts>
+#include <charconv>	//std::to_chars
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/StringInterner.h"
+
+namespace kodgen
+{
+	/**
+	*	Appends generated code to a string without building temporary strings.
+	*	
+	*	Format strings use {} placeholders, replaced by the arguments in order:
+	*		writer.writeLine("void {}::Set{}({} value) { {} = value; }", className, name, typeName, fieldName);
+	*	Unlike fmt, only the empty pair {} is a placeholder so braces of the generated C++ code don't need to be escaped.
+	*	An argument must be used to write a literal {}.
+	*/
+	class CodeWriter
+	{
+		private:
+			/**
+			*	Format argument, viewed as a string.
+			*	Numeric arguments are converted in a local buffer, so FormatArg instances can't be copied.
+			*/
+			class FormatArg
+			{
+				private:
+					/** Characters of the argument. */
+					std::string_view	_view;
+
+					/** Storage of the characters of char and integer arguments. */
+					char				_buffer[24];
+
+				public:
+					FormatArg(std::string_view string)			noexcept;
+					FormatArg(std::string const& string)		noexcept;
+					FormatArg(char const* string)				noexcept;
+					FormatArg(InternedString const& string)		noexcept;
+					FormatArg(char character)					noexcept;
+
+					template <std::integral T>
+					requires (!std::same_as<T, char> && !std::same_as<T, bool>)
+					FormatArg(T value)							noexcept;
+
+					FormatArg(FormatArg const&)					= delete;
+					FormatArg(FormatArg&&)						= delete;
+
+					/**
+					*	@brief Getter for field _view.
+					* 
+					*	@return _view.
+					*/
+					inline std::string_view	getView()	const	noexcept;
+			};
+
+			/** String the code is appended to. */
+			std::string&		_output;
+
+			/** String appended at the end of each line. */
+			std::string_view	_separator;
+
+			/** Number of tabs inserted at the beginning of each line written with writeLine. */
+			uint8				_indentLevel	= 0u;
+
+			/**
+			*	@brief Append a format string to the output, replacing each {} with the next argument.
+			* 
+			*	@param format		Format string.
+			*	@param args			Pointer to the first argument.
+			*	@param argsCount	Number of arguments. Must be the number of {} in format.
+			*/
+			void	writeFormatted(std::string_view		format,
+								   FormatArg const*		args,
+								   size_t				argsCount)	noexcept;
+
+		public:
+			/**
+			*	@param output		String the code is appended to.
+			*	@param separator	String appended at the end of each line. Must outlive the writer.
+			*						For macro code generators, use MacroCodeGenEnv::getSeparator.
+			*	@param capacityHint	Expected number of characters written, reserved upfront.
+			*/
+			CodeWriter(std::string&		output,
+					   std::string_view	separator		= "\n",
+					   size_t			capacityHint	= 0u)			noexcept;
+
+			/**
+			*	@brief	Make sure at least additionalSize characters can be appended without reallocation.
+			*			The capacity grows geometrically, so consecutive small hints don't cause a reallocation each.
+			* 
+			*	@param additionalSize Number of characters about to be written.
+			* 
+			*	@return this.
+			*/
+			CodeWriter&				reserve(size_t additionalSize)		noexcept;
+
+			/**
+			*	@brief Append a format string to the output, replacing each {} with the next argument.
+			* 
+			*	@param format	Format string.
+			*	@param args		Arguments: strings, characters or integers. There must be as many arguments as {} in format.
+			* 
+			*	@return this.
+			*/
+			template <typename... Args>
+			CodeWriter&				write(std::string_view	format,
+										  Args const&...	args)		noexcept;
+
+			/**
+			*	@brief Same as write, but the line is prefixed by the current indentation and followed by the separator.
+			* 
+			*	@param format	Format string.
+			*	@param args		Arguments: strings, characters or integers. There must be as many arguments as {} in format.
+			* 
+			*	@return this.
+			*/
+			template <typename... Args>
+			CodeWriter&				writeLine(std::string_view	format,
+											  Args const&...	args)	noexcept;
+
+			/**
+			*	@brief Append the separator to the output.
+			* 
+			*	@return this.
+			*/
+			CodeWriter&				endLine()							noexcept;
+
+			/**
+			*	@brief Increase the indentation of the lines written with writeLine by one tab.
+			* 
+			*	@return this.
+			*/
+			CodeWriter&				indent()							noexcept;
+
+			/**
+			*	@brief Decrease the indentation of the lines written with writeLine by one tab.
+			* 
+			*	@return this.
+			*/
+			CodeWriter&				unindent()							noexcept;
+
+			/**
+			*	@brief Getter for field _output.
+			* 
+			*	@return _output.
+			*/
+			inline std::string&		getOutput()					const	noexcept;
+	};
+
+	#include "Kodgen/CodeGen/CodeWriter.inl"
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <std::integral T>
+requires (!std::same_as<T, char> && !std::same_as<T, bool>)
+CodeWriter::FormatArg::FormatArg(T value) noexcept
+{
+	std::to_chars_result result = std::to_chars(_buffer, _buffer + sizeof(_buffer), value);
+
+	_view = std::string_view(_buffer, static_cast<size_t>(result.ptr - _buffer));
+}
+
+inline std::string_view CodeWriter::FormatArg::getView() const noexcept
+{
+	return _view;
+}
+
+template <typename... Args>
+CodeWriter& CodeWriter::write(std::string_view format, Args const&... args) noexcept
+{
+	//FormatArg instances are constructed in place, so numeric arguments can't outlive their buffer
+	std::array<FormatArg, sizeof...(Args)> const formatArgs = { FormatArg(args)... };
+
+	writeFormatted(format, formatArgs.data(), formatArgs.size());
+
+	return *this;
+}
+
+template <typename... Args>
+CodeWriter& CodeWriter::writeLine(std::string_view format, Args const&... args) noexcept
+{
+	_output.append(_indentLevel, '\t');
+
+	write(format, args...);
+
+	return endLine();
+}
+
+inline std::string& CodeWriter::getOutput() const noexcept
+{
+	return _output;
+}
\ No newline at end of file
@@ -33,12 +33,14 @@ namespace kodgen
 		Break,
 
 		/**
-		*	Abort the entity traversal but makes the generateCode method return true (success).
+		*	Abort the entity traversal of the code generator but makes the generateCode method return true (success).
+		*	The other code generators keep traversing the entities.
 		*/
 		AbortWithSuccess,
 
 		/**
-		*	Abort the entity traversal and make the generateCode method return false (failure).
+		*	Abort the entity traversal of the code generator and make the generateCode method return false (failure).
+		*	The other code generators keep traversing the entities so that all their errors are reported.
 		*/
 		AbortWithFailure
 	};
@@ -0,0 +1,39 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>	//std::pair
+
+#include "Kodgen/Misc/Filesystem.h"
+
+namespace kodgen
+{
+	struct FileTimings
+	{
+		public:
+			/** Path to the processed file. */
+			fs::path									file;
+
+			/** Time elapsed (in seconds) to parse the translation unit with libclang. */
+			float										parsingDuration			= 0.0f;
+
+			/** Time elapsed (in seconds) to traverse the translation unit cursors (property parsing included). */
+			float										traversalDuration		= 0.0f;
+
+			/** Time elapsed (in seconds) to parse the entities properties. */
+			float										propertyParsingDuration	= 0.0f;
+
+			/** Time elapsed (in seconds) in each code generator, in generation order. */
+			std::vector<std::pair<std::string, float>>	codeGenDurations;
+
+			/** Time elapsed (in seconds) to write the generated files. */
+			float										writeDuration			= 0.0f;
+	};
+}
\ No newline at end of file
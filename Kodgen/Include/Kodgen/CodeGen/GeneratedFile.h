@@ -8,7 +8,7 @@
 #pragma once
 
 #include <string>
-#include <fstream>
+#include <sstream>
 
 #include "Kodgen/Misc/Filesystem.h"
 
@@ -18,8 +18,13 @@ namespace kodgen
 	{
 		private:
 			fs::path		_path;
-			fs::path		_sourceFilePath;
-			std::ofstream	_streamToFile;
+			fs::path			_sourceFilePath;
+
+			/** Content of the file, written to the disk when the GeneratedFile is destroyed. */
+			std::ostringstream	_content;
+
+			/** Should the file be left untouched if its content on the disk is already up-to-date. */
+			bool				_onlyWriteIfChanged;
 
 			/**
 			*	@brief Write a single line in the generated file
@@ -50,8 +55,14 @@ namespace kodgen
 
 		public:
 			GeneratedFile()													= delete;
+			/**
+			*	@param generatedFilePath	Path to the generated file.
+			*	@param sourceFilePath		Path to the source file this file is generated from, if any.
+			*	@param onlyWriteIfChanged	If true, the file is not rewritten (and keeps its last write time) when its content on the disk is identical.
+			*/
 			GeneratedFile(fs::path&&		generatedFilePath,
-						  fs::path const&	sourceFilePath = fs::path())	noexcept;
+						  fs::path const&	sourceFilePath = fs::path(),
+						  bool				onlyWriteIfChanged = false)	noexcept;
 			GeneratedFile(GeneratedFile const&)								= delete;
 			GeneratedFile(GeneratedFile&&)									= delete;
 			~GeneratedFile()												noexcept;
@@ -11,6 +11,7 @@
 #include <functional>	//std::function
 
 #include "Kodgen/CodeGen/ETraversalBehaviour.h"
+#include "Kodgen/InfoStructures/EEntityType.h"
 #include "Kodgen/Misc/FundamentalTypes.h"
 
 namespace kodgen
@@ -106,6 +107,24 @@ namespace kodgen
 			*/
 			virtual uint8				getIterationCount()															const	noexcept;
 
+			/**
+			*	@brief	Mask of the entity types this code generator can generate code for.
+			*			The CodeGenUnit only calls callVisitorOnEntity on entities matching this mask,
+			*			other entities being traversed as if ETraversalBehaviour::Recurse was returned.
+			*			Default implementation returns all entity types.
+			* 
+			*	@return The eligible entity types mask.
+			*/
+			virtual EEntityType			getEligibleEntityMask()														const	noexcept;
+
+			/**
+			*	@brief	Name used to identify this code generator in generation reports such as timings.
+			*			Default implementation returns the (demangled when possible) dynamic type name of the generator.
+			* 
+			*	@return The name of this code generator.
+			*/
+			virtual std::string			getName()																	const	noexcept;
+
 			ICodeGenerator& operator=(ICodeGenerator const&)	= default;
 			ICodeGenerator& operator=(ICodeGenerator&&)			= default;
 	};
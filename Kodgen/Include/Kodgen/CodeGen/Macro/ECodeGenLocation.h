@@ -7,6 +7,10 @@
 
 #pragma once
 
+#include <type_traits>
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
 namespace kodgen
 {
 	enum class ECodeGenLocation
@@ -40,4 +44,49 @@ namespace kodgen
 		*/
 		Count
 	};
+
+	/**
+	*	Mask of ECodeGenLocation values.
+	*/
+	enum class ECodeGenLocationMask : uint8
+	{
+		None				= 0u,
+
+		HeaderFileHeader	= 1 << static_cast<int>(ECodeGenLocation::HeaderFileHeader),
+		ClassFooter			= 1 << static_cast<int>(ECodeGenLocation::ClassFooter),
+		HeaderFileFooter	= 1 << static_cast<int>(ECodeGenLocation::HeaderFileFooter),
+		SourceFileHeader	= 1 << static_cast<int>(ECodeGenLocation::SourceFileHeader),
+
+		All					= (1 << static_cast<int>(ECodeGenLocation::Count)) - 1
+	};
+
+	/**
+	*	@brief Binary "or" operation between 2 ECodeGenLocationMask masks.
+	* 
+	*	@param mask1 First mask.
+	*	@param mask2 Second mask.
+	* 
+	*	@return The binary "or" value between the 2 provided masks.
+	*/
+	constexpr ECodeGenLocationMask operator|(ECodeGenLocationMask mask1, ECodeGenLocationMask mask2) noexcept
+	{
+		using UnderlyingType = std::underlying_type_t<ECodeGenLocationMask>;
+
+		return static_cast<ECodeGenLocationMask>(static_cast<UnderlyingType>(mask1) | static_cast<UnderlyingType>(mask2));
+	}
+
+	/**
+	*	@brief Check whether a mask contains a code location.
+	* 
+	*	@param mask		Mask of code locations.
+	*	@param location	Code location to look for.
+	* 
+	*	@return true if location is contained in mask, else false.
+	*/
+	constexpr bool operator&&(ECodeGenLocationMask mask, ECodeGenLocation location) noexcept
+	{
+		using UnderlyingType = std::underlying_type_t<ECodeGenLocationMask>;
+
+		return (static_cast<UnderlyingType>(mask) & (1 << static_cast<int>(location))) != 0;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,61 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <array>
+
+#include "Kodgen/CodeGen/Macro/ECodeGenLocation.h"
+
+namespace kodgen
+{
+	//Forward declaration
+	class MacroCodeGenUnit;
+	class MacroCodeGenEnv;
+
+	/**
+	*	Set of sinks a macro code generator appends its entity code to, one per code location it emits to.
+	*	It allows a code generator to generate the code of all its locations in a single call.
+	*/
+	class MacroCodeEmitter
+	{
+		//MacroCodeGenUnit is the only class allowed to bind sinks.
+		friend MacroCodeGenUnit;
+
+		private:
+			/** String the generated code is appended to for each code location, nullptr if the location is not emitted to. */
+			std::array<std::string*, static_cast<size_t>(ECodeGenLocation::Count)>				_sinks		= {};
+
+			/** Separator used for each code location. */
+			std::array<std::string, static_cast<size_t>(ECodeGenLocation::Count)> const*		_separators	= nullptr;
+
+		public:
+			/**
+			*	@brief Check whether code can be emitted to the provided location.
+			* 
+			*	@param location Code location.
+			* 
+			*	@return true if the emitter has a sink for location, else false.
+			*/
+			inline bool			hasSink(ECodeGenLocation location)						const	noexcept;
+
+			/**
+			*	@brief	Update the environment code location and separator to the provided location,
+			*			and get the string the code generated for this location should be appended to.
+			* 
+			*	@param env		Generation environment structure.
+			*	@param location	Code location. The emitter must have a sink for this location.
+			* 
+			*	@return The sink of location.
+			*/
+			std::string&		selectLocation(MacroCodeGenEnv&	env,
+											   ECodeGenLocation	location)				const	noexcept;
+	};
+
+	#include "Kodgen/CodeGen/Macro/MacroCodeEmitter.inl"
+}
\ No newline at end of file
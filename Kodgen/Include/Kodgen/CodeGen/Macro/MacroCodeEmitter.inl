@@ -0,0 +1,11 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline bool MacroCodeEmitter::hasSink(ECodeGenLocation location) const noexcept
+{
+	return _sinks[static_cast<size_t>(location)] != nullptr;
+}
\ No newline at end of file
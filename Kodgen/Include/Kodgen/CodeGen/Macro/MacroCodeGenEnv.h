@@ -16,12 +16,14 @@ namespace kodgen
 {
 	//Forward declaration
 	class MacroCodeGenUnit;
+	class MacroCodeEmitter;
 
 	class MacroCodeGenEnv : public CodeGenEnv
 	{
 		//MacroCodeGenUnit is the only class allowed to set the private fields directly.
 		//Other classes must access the fields through getters.
 		friend MacroCodeGenUnit;
+		friend MacroCodeEmitter;
 
 		private:
 			/** Location the code should be generated in. */
@@ -36,6 +38,9 @@ namespace kodgen
 			/** Macro to use to hide a symbol when generated code is injected in a dynamic library. */
 			std::string			_internalSymbolMacro	= "";
 
+			/** Emitter the code generated for the current entity is appended to. */
+			MacroCodeEmitter*	_emitter				= nullptr;
+
 		public:
 			virtual ~MacroCodeGenEnv() = default;
 
@@ -66,6 +71,14 @@ namespace kodgen
 			*	@return _internalSymbolMacro.
 			*/
 			inline std::string const&	getInternalSymbolMacro()	const	noexcept;
+
+			/**
+			*	@brief	Getter for field _emitter.
+			*			The emitter is only bound while generating code for an entity.
+			* 
+			*	@return _emitter.
+			*/
+			inline MacroCodeEmitter*	getEmitter()				const	noexcept;
 	};
 
 	#include "Kodgen/CodeGen/Macro/MacroCodeGenEnv.inl"
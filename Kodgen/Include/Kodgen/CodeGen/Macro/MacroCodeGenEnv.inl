@@ -23,4 +23,9 @@ inline std::string const& MacroCodeGenEnv::getExportSymbolMacro() const noexcept
 inline std::string const& MacroCodeGenEnv::getInternalSymbolMacro() const noexcept
 {
 	return _internalSymbolMacro;
+}
+
+inline MacroCodeEmitter* MacroCodeGenEnv::getEmitter() const noexcept
+{
+	return _emitter;
 }
\ No newline at end of file
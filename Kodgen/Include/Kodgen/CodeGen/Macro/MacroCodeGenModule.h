@@ -126,11 +126,13 @@ namespace kodgen
 			virtual kodgen::uint8		getIterationCount()								const	noexcept override;
 
 			/**
-			*	@brief Generate code using the provided environment as input.
+			*	@brief	Generate code using the provided environment as input.
+			*			This method calls the generation method of each code location the MacroCodeGenEnv emitter has a sink for
+			*			(see MacroCodeGenerator::getEntityCodeLocations), between preGenerateCodeForEntity and postGenerateCodeForEntity.
 			* 
-			*	@param entity			Entity the module is generating code for. Might be nullptr, in which case the code is not generated for a specific entity.
+			*	@param entity			Entity the module is generating code for.
 			*	@param env				Environment provided by the FileGenerationUnit. You can cast environment to a more concrete type if you know the type provided by the FileGenerationUnit.
-			*	@param inout_result		String the method should append the generated code to.
+			*	@param inout_result		Unused, the generated code is appended to the sinks of the MacroCodeGenEnv emitter.
 			* 
 			*	@return A combination of all the underlying calls returning a ETraversalBehaviour.
 			*/
@@ -13,6 +13,7 @@
 
 #include "Kodgen/CodeGen/CodeGenUnit.h"
 #include "Kodgen/CodeGen/Macro/MacroCodeGenEnv.h"
+#include "Kodgen/CodeGen/Macro/MacroCodeEmitter.h"
 
 namespace kodgen
 {
@@ -29,27 +30,78 @@ namespace kodgen
 			/** Separator used for each code location. */
 			static std::array<std::string, static_cast<size_t>(ECodeGenLocation::Count)> const _separators;
 
-			/** Array containing the generated code per location. ClassFooter value is not used since code is generated in _classFooterGeneratedCode. */
-			std::array<std::string, static_cast<size_t>(ECodeGenLocation::Count)>	_generatedCodePerLocation;
+			/** Entity types owning or nested in a class footer. */
+			static constexpr EEntityType const classFooterEntityTypes = EEntityType::Struct | EEntityType::Class | EEntityType::Field | EEntityType::Method;
 
-			/** Map containing the class footer generated code for each struct/class. */
-			std::unordered_map<StructClassInfo const*, std::string>					_classFooterGeneratedCode;
+			/**
+			*	Array containing the generated code per location. ClassFooter value is not used since code is generated in _classFooterGeneratedCode.
+			*	Contains the initial code until postGenerateCode appends the entity and final code to it.
+			*/
+			std::array<std::string, static_cast<size_t>(ECodeGenLocation::Count)>				_generatedCodePerLocation;
+
+			/**
+			*	Code generated for entities, per code generator and location.
+			*	All code generators run on an entity before moving to the next one, so their code is kept apart to stay contiguous in the generated files.
+			*/
+			std::vector<std::array<std::string, static_cast<size_t>(ECodeGenLocation::Count)>>	_entityGeneratedCodePerLocation;
+
+			/** Array containing the code generated by finalGenerateCode per location. */
+			std::array<std::string, static_cast<size_t>(ECodeGenLocation::Count)>				_finalGeneratedCodePerLocation;
+
+			/** Map containing the class footer generated code for each struct/class, per code generator. */
+			std::unordered_map<StructClassInfo const*, std::vector<std::string>>				_classFooterGeneratedCode;
+
+			/** Code locations each code generator generates entity code in, in generation order. */
+			std::vector<ECodeGenLocationMask>													_entityCodeLocations;
+
+			/** Emitter bound to the code generated by the current code generator for the current entity. */
+			MacroCodeEmitter																	_emitter;
 			
+			//CodeGenUnit::generateCodeInternal statically calls generateCodeForEntityInternal
+			friend CodeGenUnit;
+
 			//Make the addModule method taking a CodeGenModule private to replace it with a more restrictive method accepting MacroCodeGenModule only.
 			using CodeGenUnit::addModule;
 
 			/**
-			*	@brief Handle the code generation for class footer code gen location.
+			*	@brief Get the string a code generator appends the class footer code of an entity to.
+			* 
+			*	@param entity				Entity we generate the code for. Must be one of Struct/Class/Field/Method.
+			*	@param codeGeneratorIndex	Index of the code generator.
+			* 
+			*	@return The class footer code generated by the code generator for the entity struct/class, or for its outer struct/class.
+			*/
+			std::string&	getEntityClassFooterGeneratedCode(EntityInfo const&	entity,
+															  uint32			codeGeneratorIndex)					noexcept;
+
+			/**
+			*	@brief Call generate for each file code location (all locations but ECodeGenLocation::ClassFooter).
+			* 
+			*	@param env						Generation environment.
+			*	@param generate					Generation function to call to generate code.
+			*	@param inout_codePerLocation	Generated code per location.
+			*/
+			void		generateFileCode(CodeGenEnv&												env,
+										 std::function<void(CodeGenEnv&,
+															std::string&)>							generate,
+										 std::array<std::string,
+													static_cast<size_t>(ECodeGenLocation::Count)>&	inout_codePerLocation)	noexcept;
+
+			/**
+			*	@brief Get the string a code generator appends the class footer code of a struct/class to.
+			* 
+			*	@param struct_				Struct/class owning the class footer.
+			*	@param codeGeneratorIndex	Index of the code generator.
 			* 
-			*	@param entity	Entity we generate the code for. Must be one of Struct/Class/Field/Method.
-			*	@param env		Generation environment.
-			*	@param generate	Code generation method.
+			*	@return The class footer code generated by the code generator for struct_.
+			*/
+			std::string&	getClassFooterGeneratedCode(StructClassInfo const*	struct_,
+														uint32					codeGeneratorIndex)						noexcept;
+
+			/**
+			*	@brief Append the code generated for entities and the final code to _generatedCodePerLocation, in generation order.
 			*/
-			void		generateEntityClassFooterCode(EntityInfo const&						entity,
-													  CodeGenEnv&							env,
-													  std::function<void(EntityInfo const&,
-																		 CodeGenEnv&,
-																		 std::string&)>		generate)	noexcept;
+			void		mergeGeneratedCode()																			noexcept;
 
 			/**
 			*	@brief	(Re)generate the header file.
@@ -84,6 +136,18 @@ namespace kodgen
 			fs::path	getGeneratedSourceFilePath(fs::path const& sourceFile)					const	noexcept;
 
 		protected:
+			/**
+			*	@brief	Statically dispatched implementation of generateCodeForEntity, hiding CodeGenUnit::generateCodeForEntityInternal.
+			*
+			*	@param entity	Target entity for code generation.
+			*	@param env		Generation environment structure.
+			*	@param generate	Generation function to call to generate code, callable as void(EntityInfo const&, CodeGenEnv&, std::string&).
+			*/
+			template <typename GenerateFunc>
+			void						generateCodeForEntityInternal(EntityInfo const&	entity,
+																	  CodeGenEnv&		env,
+																	  GenerateFunc&		generate)				noexcept;
+
 			/**
 			*	@brief	Instantiate a MacroCodeGenEnv object (using new).
 			* 
@@ -162,6 +226,18 @@ namespace kodgen
 			*/
 			virtual bool					isUpToDate(fs::path const& sourceFile)				const	noexcept	override;
 
+			/**
+			*	@brief	Same as CodeGenUnit::generateCode, but the entity traversal is statically dispatched to
+			*			MacroCodeGenUnit::generateCodeForEntityInternal instead of going through the generateCodeForEntity virtual method.
+			*
+			*	@param parsingResult	Result of a file parsing used to generate code.
+			*	@param out_timings		Optional timings to fill with the time spent in each code generator and in postGenerateCode. Can be nullptr.
+			* 
+			*	@return true if preGenerateCode, foreachModuleEntityPair and postGenerateCode calls have succeeded, else false.
+			*/
+			bool							generateCode(FileParsingResult const&	parsingResult,
+														 FileTimings*				out_timings = nullptr)	noexcept;
+
 			/**
 			*	@brief	Add a module to the internal list of generation modules.
 			*			This method is a more restrictive replacement for the CodeGenUnit::addModule(CodeGenModule&) method.
@@ -182,4 +258,6 @@ namespace kodgen
 			*/
 			void							setSettings(MacroCodeGenUnitSettings const& cguSettings)	noexcept;
 	};
+
+	#include "Kodgen/CodeGen/Macro/MacroCodeGenUnit.inl"
 }
\ No newline at end of file
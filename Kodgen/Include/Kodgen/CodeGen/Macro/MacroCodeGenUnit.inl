@@ -0,0 +1,37 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename GenerateFunc>
+void MacroCodeGenUnit::generateCodeForEntityInternal(EntityInfo const& entity, CodeGenEnv& env, GenerateFunc& generate) noexcept
+{
+	MacroCodeGenEnv&		macroEnv			= static_cast<MacroCodeGenEnv&>(env);
+	uint32					codeGeneratorIndex	= env.getCodeGeneratorIndex();
+	ECodeGenLocationMask	locations			= _entityCodeLocations[codeGeneratorIndex];
+	auto&					codePerLocation		= _entityGeneratedCodePerLocation[codeGeneratorIndex];
+
+	//Bind a sink to each code location the code generator emits to
+	for (size_t i = 0u; i < static_cast<size_t>(ECodeGenLocation::Count); i++)
+	{
+		_emitter._sinks[i] = (locations && static_cast<ECodeGenLocation>(i)) ? &codePerLocation[i] : nullptr;
+	}
+
+	/**
+	*	Forward ECodeGenLocation::ClassFooter generation only if the entity is a
+	*	struct, class, method or field
+	*/
+	if (_emitter.hasSink(ECodeGenLocation::ClassFooter))
+	{
+		_emitter._sinks[static_cast<size_t>(ECodeGenLocation::ClassFooter)] = (entity.entityType && classFooterEntityTypes) ?
+																				&getEntityClassFooterGeneratedCode(entity, codeGeneratorIndex) :
+																				nullptr;
+	}
+
+	macroEnv._emitter = &_emitter;
+
+	//Generate the code of all locations in a single call, the code generator appends code to the emitter sinks
+	generate(entity, macroEnv, codePerLocation[static_cast<size_t>(ECodeGenLocation::HeaderFileHeader)]);
+}
\ No newline at end of file
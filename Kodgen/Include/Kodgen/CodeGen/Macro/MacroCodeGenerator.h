@@ -88,6 +88,15 @@ namespace kodgen
 			MacroCodeGenerator(MacroCodeGenerator&&)		= default;
 			virtual ~MacroCodeGenerator()					= default;
 
+			/**
+			*	@brief	Get the code locations this code generator generates entity code in.
+			*			The generate*CodeForEntity methods of other locations are never called, which saves a dispatch per entity and location.
+			*			Overriding this method is recommended for code generators emitting to only a few locations.
+			* 
+			*	@return ECodeGenLocationMask::All.
+			*/
+			virtual ECodeGenLocationMask	getEntityCodeLocations()		const	noexcept;
+
 			/**
 			*	@brief	Generate initial code for this code generator.
 			*			This method analyzes the code location retrieved from the MacroCodeGenEnv
@@ -125,14 +125,14 @@ namespace kodgen
 
 			/**
 			*	@brief	Generate code for a given entity.
-			*			This method analyzes the code location retrieved from the MacroCodeGenEnv
-			*			and dispatch the call to the relevant method.
+			*			This method calls the generation method of each code location the MacroCodeGenEnv emitter has a sink for
+			*			(see MacroCodeGenerator::getEntityCodeLocations), between preGenerateCodeForEntity and postGenerateCodeForEntity.
 			*	
 			*	@param entity			Entity to generate code for.
 			*	@param property			Property that triggered the property generation.
 			*	@param propertyIndex	Index of the property in the entity's propertyGroup.
 			*	@param env				Generation environment structure.
-			*	@param inout_result		String the method should append the generated code to.
+			*	@param inout_result		Unused, the generated code is appended to the sinks of the MacroCodeGenEnv emitter.
 			*	
 			*	@return true if the generation completed successfully, else false.
 			*/
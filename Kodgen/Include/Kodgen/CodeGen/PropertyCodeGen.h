@@ -77,6 +77,21 @@ namespace kodgen
 			bool						shouldIterateOnNestedEntities(EntityInfo const& entity)						const	noexcept;
 
 		public:
+			/**
+			*	@brief	Templated implementation of callVisitorOnEntity, usable with any visitor without wrapping it in a std::function.
+			*			Call the visitor once for each entity/property pair this generator should generate code for.
+			* 
+			*	@param entity	The entity provided to the visitor.
+			*	@param env		The environment provided to the visitor.
+			*	@param visitor	The visitor to run. Must be callable as ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*).
+			* 
+			*	@return Same as callVisitorOnEntity.
+			*/
+			template <typename Visitor>
+			ETraversalBehaviour			visitEntity(EntityInfo const&	entity,
+													CodeGenEnv&			env,
+													Visitor&			visitor)										noexcept;
+
 			/**
 			*	@param propertyName			Name of the property this property generator should generate code for.
 			*	@param eligibleEntityMask	A mask defining all the types of entity this PropertyCodeGen instance should run on.
@@ -119,7 +134,7 @@ namespace kodgen
 			* 
 			*	@return _eligibleEntityMask.
 			*/
-			inline EEntityType			getEligibleEntityMask()											const	noexcept;
+			virtual EEntityType			getEligibleEntityMask()											const	noexcept override;
 
 			/**
 			*	@brief Getter for _propertyName field.
@@ -0,0 +1,120 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Kodgen/InfoStructures/StructClassInfo.h"
+#include "Kodgen/Misc/Filesystem.h"
+
+namespace kodgen
+{
+	/**
+	*	Memory layout analysis of a parsed struct/class: padding holes, fields straddling cache lines
+	*	and a field order minimizing the padding.
+	*	Cache lines are counted from the beginning of the struct, so the analysis assumes instances are cache line aligned.
+	*/
+	struct StructLayout
+	{
+		public:
+			struct Field
+			{
+				/** Name of the field. */
+				std::string	name;
+
+				/** Full name of the field type. */
+				std::string	typeName;
+
+				/** Offset of the field in the struct, in bytes. */
+				size_t		offset				= 0u;
+
+				/** Size of the field, in bytes. */
+				size_t		size				= 0u;
+
+				/** Alignment of the field type, in bytes. */
+				size_t		alignment			= 0u;
+
+				/** Does the field span over 2 cache lines while it could fit in a single one? */
+				bool		straddlesCacheLine	= false;
+			};
+
+			struct PaddingHole
+			{
+				/** Offset of the first padding byte in the struct. */
+				size_t	offset	= 0u;
+
+				/** Number of padding bytes. */
+				size_t	size	= 0u;
+			};
+
+			/** Cache line size used to detect straddling fields. */
+			static constexpr size_t		cacheLineSize	= 64u;
+
+			/** File the struct is declared in. */
+			fs::path					file;
+
+			/** Full name of the struct. */
+			std::string					name;
+
+			/** Size of the struct, in bytes. */
+			size_t						size			= 0u;
+
+			/** Alignment of the struct, in bytes. */
+			size_t						alignment		= 0u;
+
+			/** Non-static fields of the struct, sorted by offset. */
+			std::vector<Field>			fields;
+
+			/** Padding between the fields and after the last field (tail padding). */
+			std::vector<PaddingHole>	paddingHoles;
+
+			/**
+			*	Field names sorted in the order minimizing padding (decreasing alignment, then decreasing size).
+			*	Empty if the current order is already minimal or if the layout of some fields is unknown (i.e. bit fields).
+			*/
+			std::vector<std::string>	suggestedOrder;
+
+			/** Size of the struct if its fields were declared in suggestedOrder. Equal to size if suggestedOrder is empty. */
+			size_t						suggestedSize	= 0u;
+
+			/**
+			*	@brief Compute the layout of a struct/class.
+			*
+			*	@param structClass	Struct/class to analyze. Its type layout must have been computed during parsing (EParsedData::TypeLayout).
+			*	@param declaringFile	File the struct/class is declared in.
+			*	@param out_layout		Layout to fill.
+			*
+			*	@return true if the layout could be computed, false if the struct/class size or the layout of its fields is unknown.
+			*/
+			static bool	compute(StructClassInfo const&	structClass,
+								fs::path const&			declaringFile,
+								StructLayout&			out_layout)				noexcept;
+
+			/**
+			*	@brief Get the total number of padding bytes of the struct.
+			*
+			*	@return The sum of all padding holes sizes.
+			*/
+			size_t		getPaddingSize()								const	noexcept;
+
+			/**
+			*	@brief Get the number of fields straddling cache lines.
+			*
+			*	@return The number of fields with straddlesCacheLine set.
+			*/
+			size_t		getStraddlingFieldsCount()						const	noexcept;
+
+			/**
+			*	@brief Build a one line human readable summary of the layout issues, used to issue warnings.
+			*
+			*	@return The summary string.
+			*/
+			std::string	getSummary()									const	noexcept;
+	};
+}
\ No newline at end of file
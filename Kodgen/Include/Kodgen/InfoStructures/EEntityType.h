@@ -8,6 +8,9 @@
 #pragma once
 
 #include <type_traits>
+#include <bit>	//std::countr_zero
+
+#include "Kodgen/Misc/FundamentalTypes.h"
 
 namespace kodgen
 {
@@ -90,4 +93,22 @@ namespace kodgen
 	{
 		return (mask1 & mask2) != EEntityType::Undefined;
 	}
+
+	/** Number of single-bit EEntityType values. */
+	constexpr size_t		entityTypesCount	= 9u;
+
+	/** Mask containing all entity types. */
+	constexpr EEntityType	allEntityTypes		= static_cast<EEntityType>((1u << entityTypesCount) - 1u);
+
+	/**
+	*	@brief Get the index of a single-bit entity type, in [0, entityTypesCount[.
+	* 
+	*	@param entityType Entity type. Must not be a mask of several types.
+	* 
+	*	@return The index of the entity type.
+	*/
+	constexpr size_t getEntityTypeIndex(EEntityType entityType) noexcept
+	{
+		return static_cast<size_t>(std::countr_zero(static_cast<std::underlying_type_t<EEntityType>>(entityType)));
+	}
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 #include <clang-c/Index.h>
 
 #include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/StringInterner.h"
 #include "Kodgen/InfoStructures/EEntityType.h"
 #include "Kodgen/Properties/Property.h"
 
@@ -21,6 +22,10 @@ namespace kodgen
 {
 	class EntityInfo
 	{
+		private:
+			/** Full name of this entity, computed once by cacheFullName. */
+			InternedString			_fullName;
+
 		public:
 			/** Type of entity. */
 			EEntityType				entityType	= EEntityType::Undefined;
@@ -28,7 +33,7 @@ namespace kodgen
 			/** Name of the entity. */
 			std::string				name;
 			
-			/** Unique id of the entity. */
+			/** Unique id of the entity. Empty if EParsedData::EntityId was not requested when parsing. */
 			std::string				id;
 
 			/** Line number of the entity in the file */
@@ -61,11 +66,25 @@ namespace kodgen
 			static std::string getFullName(CXCursor const& cursor)	noexcept;
 
 			/**
-			*	@brief Generates the full name of this entity (with outer entities).
+			*	@brief	Get the full name of this entity (with outer entities).
+			*			The name is generated from the outer entities unless it has been cached by cacheFullName.
 			*	
 			*	@return The full name of the entity.
 			*/
-			std::string getFullName()						const	noexcept;
+			std::string		getFullName()					const	noexcept;
+
+			/**
+			*	@brief Getter for the field _fullName.
+			*	
+			*	@return The interned full name of the entity, or an empty handle if it has not been cached.
+			*/
+			InternedString	getInternedFullName()			const	noexcept;
+
+			/**
+			*	@brief	Compute, intern and store the full name of this entity.
+			*			Called once the outer entities are final, outer entities being cached first. Internal use only.
+			*/
+			void			cacheFullName()							noexcept;
 	};
 
 	std::ostream& operator<<(std::ostream& out_stream, EntityInfo const&) noexcept;
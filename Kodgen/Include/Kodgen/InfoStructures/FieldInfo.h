@@ -22,10 +22,13 @@ namespace kodgen
 			/** Is this field mutable qualified? */
 			bool							isMutable : 1;
 
+			/** Is this field a bit-field? Bit-fields have no address, so offsetof can't be used on them. */
+			bool							isBitField : 1;
+
 			/** Access of this field in its outer struct/class. */
 			EAccessSpecifier				accessSpecifier;
 
-			/** Memory offset in bytes. */
+			/** Memory offset in bytes, or a negative CXTypeLayoutError if it could not be computed (e.g. fields of class templates). */
 			int64							memoryOffset;
 
 			FieldInfo(CXCursor const&			cursor,
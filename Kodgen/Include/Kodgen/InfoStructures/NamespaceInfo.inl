@@ -17,7 +17,7 @@ void NamespaceInfo::foreachEntityOfType(EEntityType entityMask, Functor visitor)
 	}
 
 	//Propagate call on nested entities
-	if (entityMask && NamespaceInfo::nestedEntityTypes)	//EEntityType::Namespace is already included in NamespaceInfo::nestedEntityTypes
+	if ((entityMask && NamespaceInfo::nestedEntityTypes) || (entityMask && EnumInfo::nestedEntityTypes))	//EEntityType::Namespace is already included in NamespaceInfo::nestedEntityTypes
 	{
 		for (NamespaceInfo const& namespace_ : namespaces)
 		{
@@ -25,7 +25,7 @@ void NamespaceInfo::foreachEntityOfType(EEntityType entityMask, Functor visitor)
 		}
 	}
 
-	if (entityMask && StructClassInfo::nestedEntityTypes)	//EEntityType::Class and EEntityType::Struct are already included in StructClassInfo::nestedEntityTypes
+	if ((entityMask && StructClassInfo::nestedEntityTypes) || (entityMask && EnumInfo::nestedEntityTypes))	//EEntityType::Class and EEntityType::Struct are already included in StructClassInfo::nestedEntityTypes
 	{
 		for (StructClassInfo const& class_ : classes)
 		{
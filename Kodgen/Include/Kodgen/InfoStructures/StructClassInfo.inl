@@ -17,7 +17,7 @@ void StructClassInfo::foreachEntityOfType(EEntityType entityMask, Functor visito
 	}
 
 	//Propagate call on nested entities
-	if (entityMask && StructClassInfo::nestedEntityTypes)	//EEntityType::Class and EEntityType::Struct are already included in StructClassInfo::nestedEntityTypes
+	if ((entityMask && StructClassInfo::nestedEntityTypes) || (entityMask && EnumInfo::nestedEntityTypes))	//EEntityType::Class and EEntityType::Struct are already included in StructClassInfo::nestedEntityTypes
 	{
 		for (std::shared_ptr<NestedStructClassInfo> const& struct_ : nestedStructs)
 		{
@@ -42,9 +42,9 @@ void StructClassInfo::foreachEntityOfType(EEntityType entityMask, Functor visito
 
 	if (entityMask && EEntityType::Field)
 	{
-		for (MethodInfo const& method : methods)
+		for (FieldInfo const& field : fields)
 		{
-			visitor(method);
+			visitor(field);
 		}
 	}
 
@@ -13,6 +13,7 @@
 #include <clang-c/Index.h>
 
 #include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/StringInterner.h"
 #include "Kodgen/InfoStructures/TypeDescriptor.h"
 #include "Kodgen/InfoStructures/TemplateParamInfo.h"
 
@@ -33,11 +34,13 @@ namespace kodgen
 			*	such as const, volatile or nested info (namespace, outer class).
 			*
 			*	i.e. const volatile ExampleNamespace::ExampleClass *const*&
+			*
+			*	Interned in the global StringInterner since the same types appear in many entities.
 			*/
-			std::string						_fullName			= "";
+			InternedString					_fullName;
 
 			/** The canonical full name is the full name simplified by unwinding all aliases / typedefs. */
-			std::string						_canonicalFullName	= "";
+			InternedString					_canonicalFullName;
 
 			/** List of typenames of the template type, empty if this is not a template type. */
 			std::vector<TemplateParamInfo>	_templateParameters;
@@ -72,9 +75,20 @@ namespace kodgen
 			*/
 			static void			removeTemplateParameters(std::string& typeString)				noexcept;
 
-			/** Init all internal flags according to the provided type. */
+			/**
+			*	@brief	Init all internal flags according to the provided type.
+			*			The canonical name and layout are only computed if requested by the current ParsedDataScope.
+			*/
 			void initialize(CXType cursorType)											noexcept;
 
+			/**
+			*	@brief Fill sizeInBytes, alignment and typeParts.
+			* 
+			*	@param cursorType		Type to retrieve the size of.
+			*	@param canonicalType	Canonical type of cursorType, decomposed into type parts.
+			*/
+			void computeLayout(CXType cursorType, CXType canonicalType)					noexcept;
+
 			/** Init all internal flags according to the provided cursor. */
 			void initialize(CXCursor cursor)											noexcept;
 
@@ -122,12 +136,20 @@ namespace kodgen
 			*		{ CArray 2, CArray 3, Value }	/!\ Array parts ONLY are read from left to right (not right to left)
 			*	One more: if the type is int*[2][3], the array would be
 			*		{ CArray 2, CArray 3, Ptr, Value }
+			*
+			*	Empty if EParsedData::TypeLayout was not requested when parsing.
 			*/
 			std::vector<TypePart>	typeParts;
 
-			/** Size of this type in bytes. */
+			/** Size of this type in bytes. 0 if EParsedData::TypeLayout was not requested when parsing. */
 			size_t					sizeInBytes			= 0u;
 
+			/** Alignment of this type in bytes. 0 if EParsedData::TypeLayout was not requested when parsing. */
+			size_t					alignment			= 0u;
+
+			/** Is this type a POD, and so trivially copyable? false if EParsedData::TypeLayout was not requested when parsing. */
+			bool					isPOD				= false;
+
 			TypeInfo()					= default;
 			TypeInfo(CXType cursorType)	noexcept;
 			TypeInfo(CXCursor cursor)	noexcept;
@@ -159,6 +181,7 @@ namespace kodgen
 			/**
 			*	@brief	Get this type canonical name.
 			*			The canonical name is the name simplified by unwinding all aliases and/or typedefs.
+			*			If EParsedData::CanonicalTypeName was not requested when parsing, the full name is used instead.
 			*
 			*	@param removeQualifiers Should the const and volatile qualifiers be removed from the type name.
 			*	@param removeNamespacesAndNestedClasses Should the namespaces and nested classes be removed from the type name.
@@ -168,6 +191,21 @@ namespace kodgen
 			std::string								getCanonicalName(bool removeQualifiers							= false,
 																	 bool shouldRemoveNamespacesAndNestedClasses	= false)	const	noexcept;
 
+			/**
+			*	@brief	Getter for the field _fullName.
+			*			Two types have the same full name if and only if their interned full names are equal (pointer compare).
+			*
+			*	@return _fullName.
+			*/
+			InternedString							getInternedFullName()														const	noexcept;
+
+			/**
+			*	@brief Getter for the field _canonicalFullName.
+			*
+			*	@return _canonicalFullName.
+			*/
+			InternedString							getInternedCanonicalFullName()												const	noexcept;
+
 			/**
 			*	@brief Getter for the field _templateParameters.
 			* 
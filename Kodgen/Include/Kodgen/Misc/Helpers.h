@@ -8,9 +8,12 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include <clang-c/Index.h>
 
+#include "Kodgen/Misc/FundamentalTypes.h"
+
 namespace kodgen
 {
 	class Helpers
@@ -45,6 +48,26 @@ namespace kodgen
 			*	@return "true" if the boolean is true, else "false".
 			*/
 			static inline std::string	toString(bool value)					noexcept;
+
+			/**
+			*	@brief Escape the provided string so that it can be used as a JSON string value.
+			*	
+			*	@param value The string to escape.
+			*	
+			*	@return The escaped string, quotes included.
+			*/
+			static std::string			toJsonString(std::string const& value)	noexcept;
+
+			/**
+			*	@brief	Compute the 64-bit FNV-1a hash of a string.
+			*			Unlike std::hash, the result is specified and stable across runs, machines and standard libraries,
+			*			so it can safely be written to generated files.
+			*	
+			*	@param str The string to hash.
+			*	
+			*	@return The FNV-1a hash of the string.
+			*/
+			static constexpr uint64	fnv1a64(std::string_view str)			noexcept;
 	};
 
 	#include "Kodgen/Misc/Helpers.inl"
@@ -8,4 +8,17 @@
 inline std::string Helpers::toString(bool value) noexcept
 {
 	return (value) ? "true" : "false";
+}
+
+constexpr uint64 Helpers::fnv1a64(std::string_view str) noexcept
+{
+	uint64 hash = 14695981039346656037ull;
+
+	for (char c : str)
+	{
+		hash ^= static_cast<uint8>(c);
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
 }
\ No newline at end of file
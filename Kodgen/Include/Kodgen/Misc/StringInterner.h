@@ -0,0 +1,92 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <shared_mutex>
+
+namespace kodgen
+{
+	/**
+	*	Handle to a string owned by a StringInterner.
+	*	Two handles from the same interner are equal if and only if they point to the same string, so comparisons are pointer compares.
+	*	The empty string is never interned: both the default handle and the handle of "" are empty and equal.
+	*/
+	class InternedString
+	{
+		private:
+			/** Interned string, nullptr for the empty string. */
+			std::string const*	_string	= nullptr;
+
+		public:
+			InternedString()							= default;
+			explicit InternedString(std::string const* string)	noexcept;
+
+			/**
+			*	@return The interned string, or an empty string if this handle is empty.
+			*/
+			inline std::string const&	str()											const	noexcept;
+
+			/**
+			*	@return true if this handle is the empty string, else false.
+			*/
+			inline bool					empty()											const	noexcept;
+
+			inline						operator std::string const&()					const	noexcept;
+
+			inline bool					operator==(InternedString const& other)			const	noexcept;
+			inline bool					operator!=(InternedString const& other)			const	noexcept;
+	};
+
+	/**
+	*	Thread-safe table of unique strings.
+	*	Interned strings are never released, so handles stay valid as long as the interner lives.
+	*/
+	class StringInterner
+	{
+		private:
+			struct Hash
+			{
+				using is_transparent = void;
+
+				inline size_t operator()(std::string_view string)	const	noexcept;
+			};
+
+			/** Mutex protecting _strings. Lookups of already interned strings only take a shared lock. */
+			mutable std::shared_mutex								_mutex;
+
+			/** Interned strings. Nodes never move, so pointers to the strings stay valid on rehash. */
+			std::unordered_set<std::string, Hash, std::equal_to<>>	_strings;
+
+		public:
+			/**
+			*	@brief Get the handle of a string, interning it if it wasn't already.
+			*
+			*	@param string The string to intern.
+			*
+			*	@return The handle of the string.
+			*/
+			InternedString			intern(std::string_view string)		noexcept;
+
+			/**
+			*	@return The number of interned strings.
+			*/
+			size_t					size()						const	noexcept;
+
+			/**
+			*	@brief Get the interner shared by the whole project (all parsers and generation threads).
+			*
+			*	@return The global interner.
+			*/
+			static StringInterner&	getGlobal()							noexcept;
+	};
+
+	#include "Kodgen/Misc/StringInterner.inl"
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline std::string const& InternedString::str() const noexcept
+{
+	static std::string const emptyString;
+
+	return (_string != nullptr) ? *_string : emptyString;
+}
+
+inline bool InternedString::empty() const noexcept
+{
+	return _string == nullptr;
+}
+
+inline InternedString::operator std::string const&() const noexcept
+{
+	return str();
+}
+
+inline bool InternedString::operator==(InternedString const& other) const noexcept
+{
+	return _string == other._string;
+}
+
+inline bool InternedString::operator!=(InternedString const& other) const noexcept
+{
+	return _string != other._string;
+}
+
+inline size_t StringInterner::Hash::operator()(std::string_view string) const noexcept
+{
+	return std::hash<std::string_view>()(string);
+}
\ No newline at end of file
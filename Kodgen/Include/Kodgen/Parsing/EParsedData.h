@@ -0,0 +1,81 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <type_traits>
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Optional entity data computed while traversing a translation unit.
+	*	Each flag costs libclang queries for every parsed entity, so the parser only computes the data
+	*	code generators declare they need (see CodeGenModule::getRequiredParsedData).
+	*/
+	enum class EParsedData : uint8
+	{
+		/** Only the data always computed by the parser. */
+		None				= 0u,
+
+		/** EntityInfo::id (clang USR). */
+		EntityId			= 1 << 0,
+
+		/** Canonical spelling of types, retrieved with TypeInfo::getCanonicalName. */
+		CanonicalTypeName	= 1 << 1,
+
+		/** TypeInfo::sizeInBytes, TypeInfo::alignment, TypeInfo::isPOD and TypeInfo::typeParts. */
+		TypeLayout			= 1 << 2,
+
+		/** All optional data. */
+		All					= EntityId | CanonicalTypeName | TypeLayout
+	};
+
+	/**
+	*	@brief Binary "or" operation between 2 EParsedData masks.
+	* 
+	*	@param mask1 First mask.
+	*	@param mask2 Second mask.
+	* 
+	*	@return The binary "or" value between the 2 provided masks.
+	*/
+	constexpr EParsedData operator|(EParsedData mask1, EParsedData mask2) noexcept
+	{
+		using UnderlyingType = std::underlying_type_t<EParsedData>;
+
+		return static_cast<EParsedData>(static_cast<UnderlyingType>(mask1) | static_cast<UnderlyingType>(mask2));
+	}
+
+	/**
+	*	@brief Binary "and" operation between 2 EParsedData masks.
+	* 
+	*	@param mask1 First mask.
+	*	@param mask2 Second mask.
+	* 
+	*	@return The binary "and" value between the 2 provided masks.
+	*/
+	constexpr EParsedData operator&(EParsedData mask1, EParsedData mask2) noexcept
+	{
+		using UnderlyingType = std::underlying_type_t<EParsedData>;
+
+		return static_cast<EParsedData>(static_cast<UnderlyingType>(mask1) & static_cast<UnderlyingType>(mask2));
+	}
+
+	/**
+	*	@brief Check if 2 EParsedData masks overlap.
+	* 
+	*	@param mask1 First mask to compare.
+	*	@param mask2 Second mask to compare.
+	* 
+	*	@return true if the 2 masks overlap, else false.
+	*/
+	constexpr bool operator&&(EParsedData mask1, EParsedData mask2) noexcept
+	{
+		return (mask1 & mask2) != EParsedData::None;
+	}
+}
\ No newline at end of file
@@ -14,6 +14,7 @@
 
 #include "Kodgen/Parsing/ParsingContext.h"
 #include "Kodgen/Parsing/ParsingSettings.h"
+#include "Kodgen/Threading/CancellationToken.h"
 #include "Kodgen/InfoStructures/EntityInfo.h"
 #include "Kodgen/Misc/FundamentalTypes.h"
 
@@ -32,6 +33,25 @@ namespace kodgen
 			*/
 			void	updateShouldParseAllNested(EntityInfo const& parsingEntity)		noexcept;
 
+			/**
+			*	@brief	Check whether the parsing should stop after an entity has been parsed, either because
+			*			the whole run has been cancelled or because an error occured and ParsingSettings::shouldAbortParsingOnFirstError is set.
+			*
+			*	@param parentContext	Context the entity has been parsed in.
+			*	@param result			Result of the entity parsing.
+			*
+			*	@return true if the parsing should stop, else false.
+			*/
+			static bool	shouldAbortParsing(ParsingContext const&	parentContext,
+										   ParsingResultBase const&	result)			noexcept;
+
+			/**
+			*	@brief Check if the run-wide cancellation token of the current context has been triggered.
+			*	
+			*	@return true if the parsing has been cancelled, else false.
+			*/
+			inline bool						isCancelled()					const	noexcept;
+
 			/**
 			*	@brief Check if the current entity (stored in the current context) should be parsed.
 			*	
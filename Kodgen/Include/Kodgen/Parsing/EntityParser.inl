@@ -12,6 +12,13 @@ inline bool EntityParser::shouldParseCurrentEntity() const noexcept
 	return context.parentContext != nullptr && context.parentContext->shouldParseAllNested;
 }
 
+inline bool EntityParser::isCancelled() const noexcept
+{
+	ParsingContext const& context = getContext();
+
+	return context.cancellationToken != nullptr && context.cancellationToken->isCancelled();
+}
+
 inline ParsingContext& EntityParser::getContext() noexcept
 {
 	//Can't retrieve the context if there is none.
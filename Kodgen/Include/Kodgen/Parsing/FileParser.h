@@ -19,6 +19,7 @@
 #include "Kodgen/Parsing/PropertyParser.h"
 #include "Kodgen/Misc/Filesystem.h"
 #include "Kodgen/Misc/ILogger.h"
+#include "Kodgen/Threading/ThreadJoiner.h"
 
 namespace kodgen
 {
@@ -47,6 +48,31 @@ namespace kodgen
 														  CXCursor		parentCursor,
 														  CXClientData	clientData)						noexcept;
 
+			/**
+			*	@brief	Parse the translation unit of the provided file with libclang.
+			*			If ParsingSettings::parseTimeout is set, the parsing runs on a helper thread which is abandoned
+			*			as soon as the time budget is exceeded.
+			*
+			*	@param toParseFile	Path to the file to parse.
+			*	@param out_result	Result to fill with the parsing duration / timeout state.
+			*
+			*	@return The parsed translation unit, or nullptr if the parsing failed or timed out.
+			*/
+			CXTranslationUnit			parseTranslationUnit(fs::path const&	toParseFile,
+															 FileParsingResult&	out_result)				noexcept;
+
+			/**
+			*	@brief	Compute the id of a parsed file, used to name the macros of the generated header.
+			*			The id is the FNV-1a hash of the file path relative to the project root directory (with / separators),
+			*			so it is identical from one checkout, machine or standard library to another.
+			*			Files outside of the project root directory fall back to their absolute path.
+			*
+			*	@param parsedFile Sanitized path of the parsed file.
+			*
+			*	@return The id of the file.
+			*/
+			std::string					computeFileId(fs::path const& parsedFile)					const	noexcept;
+
 			/**
 			*	@brief Push a new clean context to prepare translation unit parsing.
 			*
@@ -135,7 +161,16 @@ namespace kodgen
 
 		public:
 			/** Logger used to issue logs from the FileParser. Can be nullptr. */
-			ILogger*			logger	= nullptr;
+			ILogger*					logger				= nullptr;
+
+			/** Run-wide token checked during the parsing to interrupt it as soon as possible. Can be nullptr. */
+			CancellationToken const*	cancellationToken	= nullptr;
+
+			/**
+			*	Owner of the helper threads of the parsings abandoned after ParsingSettings::parseTimeout, libclang being unable to interrupt them.
+			*	If nullptr, the parser waits for an abandoned parsing to finish before returning.
+			*/
+			ThreadJoiner*				timedOutParsingsJoiner	= nullptr;
 
 			FileParser()					noexcept;
 			FileParser(FileParser const&)	noexcept;
@@ -0,0 +1,47 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Kodgen/Parsing/EParsedData.h"
+
+namespace kodgen
+{
+	/**
+	*	RAII object defining the optional data computed by entity constructors on the calling thread.
+	*	Entities are built from within libclang visitors which can't forward parser settings,
+	*	so FileParser opens a scope for the duration of a translation unit traversal.
+	*	Outside of any scope, all data is computed.
+	*/
+	class ParsedDataScope
+	{
+		private:
+			/** Data computed by entity constructors on the current thread. */
+			static thread_local EParsedData	_current;
+
+			/** Data computed before this scope was opened, restored on destruction. */
+			EParsedData						_previous;
+
+		public:
+			explicit ParsedDataScope(EParsedData parsedData)	noexcept;
+			ParsedDataScope(ParsedDataScope const&)				= delete;
+			ParsedDataScope(ParsedDataScope&&)					= delete;
+			~ParsedDataScope()									noexcept;
+
+			/**
+			*	@brief Check whether entity constructors should compute the provided data on the current thread.
+			* 
+			*	@param parsedData Data to check.
+			* 
+			*	@return true if all the provided data should be computed, else false.
+			*/
+			static bool	shouldCompute(EParsedData parsedData)	noexcept;
+
+			ParsedDataScope& operator=(ParsedDataScope const&)	= delete;
+			ParsedDataScope& operator=(ParsedDataScope&&)		= delete;
+	};
+}
\ No newline at end of file
@@ -18,6 +18,7 @@ namespace kodgen
 	class	PropertyParser;
 	class	ParsingSettings;
 	class	StructClassTree;
+	class	CancellationToken;
 
 	struct ParsingContext
 	{
@@ -52,5 +53,8 @@ namespace kodgen
 
 			/** Result of the parsing. */
 			ParsingResultBase*		parsingResult				= nullptr;
+
+			/** Run-wide token used to interrupt the parsing as soon as possible. Can be nullptr. */
+			CancellationToken const*	cancellationToken		= nullptr;
 	};
 }
\ No newline at end of file
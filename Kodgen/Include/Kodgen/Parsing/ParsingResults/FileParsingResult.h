@@ -13,6 +13,7 @@
 #include "Kodgen/Parsing/ParsingError.h"
 #include "Kodgen/Parsing/ParsingSettings.h"
 #include "Kodgen/Parsing/ParsingResults/ParsingResultBase.h"
+#include "Kodgen/Parsing/ParsingResults/FlatEntityIndex.h"
 #include "Kodgen/InfoStructures/NamespaceInfo.h"
 #include "Kodgen/InfoStructures/StructClassInfo.h"
 #include "Kodgen/InfoStructures/NestedStructClassInfo.h"
@@ -33,6 +34,18 @@ namespace kodgen
 			/** Unique file id */
 			std::string						fileId;
 
+			/** Set to true if the translation unit parsing exceeded ParsingSettings::parseTimeout and was abandoned. */
+			bool							timedOut				= false;
+
+			/** Time elapsed (in seconds) to parse the translation unit, or until it was abandoned if timedOut is true. */
+			float							parsingDuration			= 0.0f;
+
+			/** Time elapsed (in seconds) to traverse the translation unit cursors and build the entities (property parsing included). */
+			float							traversalDuration		= 0.0f;
+
+			/** Time elapsed (in seconds) to parse the entities properties. */
+			float							propertyParsingDuration	= 0.0f;
+
 			/** All namespaces contained directly under file level. */
 			std::vector<NamespaceInfo>		namespaces;
 
@@ -55,13 +68,30 @@ namespace kodgen
 			StructClassTree					structClassTree;
 
 			/**
-			*	@brief Call a visitor function on each entity of the provided type(s) contained in a file.
+			*	Flat index of all the entities above, built once parsing succeeded.
+			*	It must be rebuilt (or cleared) if the entities are modified afterwards.
+			*/
+			FlatEntityIndex					entityIndex;
+
+			/**
+			*	@brief	Call a visitor function on each entity of the provided type(s) contained in a file.
+			*			Iterates over entityIndex when it has been built, else walks the entities tree.
+			* 
+			*	@param entityMask	All types of entities the visitor function should be called on.
+			*	@param visitor		Function to call on entities.
+			*/
+			template <typename Functor, typename = std::enable_if_t<std::is_invocable_v<Functor, EntityInfo const&>>>
+			void foreachEntityOfType(EEntityType entityMask, Functor visitor)			const	noexcept;
+
+			/**
+			*	@brief	Call a visitor function on each entity of the provided type(s) contained in a file, walking the entities tree.
+			*			Visits the same entities in the same order as entityIndex.
 			* 
 			*	@param entityMask	All types of entities the visitor function should be called on.
 			*	@param visitor		Function to call on entities.
 			*/
 			template <typename Functor, typename = std::enable_if_t<std::is_invocable_v<Functor, EntityInfo const&>>>
-			void foreachEntityOfType(EEntityType entityMask, Functor visitor)	const	noexcept;
+			void foreachEntityOfTypeInTree(EEntityType entityMask, Functor visitor)	const	noexcept;
 	};
 
 	#include "Kodgen/Parsing/ParsingResults/FileParsingResult.inl"
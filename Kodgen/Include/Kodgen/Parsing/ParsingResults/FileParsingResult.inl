@@ -8,7 +8,20 @@
 template <typename Functor, typename>
 void FileParsingResult::foreachEntityOfType(EEntityType entityMask, Functor visitor) const noexcept
 {
-	if (entityMask && NamespaceInfo::nestedEntityTypes) //EEntityType::Namespace is already included in NamespaceInfo::nestedEntityTypes
+	if (!entityIndex.empty())
+	{
+		entityIndex.foreachEntityOfType(*this, entityMask, visitor);
+	}
+	else
+	{
+		foreachEntityOfTypeInTree(entityMask, visitor);
+	}
+}
+
+template <typename Functor, typename>
+void FileParsingResult::foreachEntityOfTypeInTree(EEntityType entityMask, Functor visitor) const noexcept
+{
+	if ((entityMask && NamespaceInfo::nestedEntityTypes) || (entityMask && EnumInfo::nestedEntityTypes)) //EEntityType::Namespace is already included in NamespaceInfo::nestedEntityTypes
 	{
 		for (NamespaceInfo const& namespace_ : namespaces)
 		{
@@ -16,7 +29,7 @@ void FileParsingResult::foreachEntityOfType(EEntityType entityMask, Functor visi
 		}
 	}
 
-	if (entityMask && StructClassInfo::nestedEntityTypes)	//EEntityType::Class and EEntityType::Struct are already included in StructClassInfo::nestedEntityTypes
+	if ((entityMask && StructClassInfo::nestedEntityTypes) || (entityMask && EnumInfo::nestedEntityTypes))	//EEntityType::Class and EEntityType::Struct are already included in StructClassInfo::nestedEntityTypes
 	{
 		for (StructClassInfo const& class_ : classes)
 		{
@@ -0,0 +1,191 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <array>
+#include <utility>
+#include <limits>
+#include <type_traits>
+
+#include "Kodgen/InfoStructures/EntityInfo.h"
+#include "Kodgen/InfoStructures/EEntityType.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	//Forward declarations
+	class FileParsingResult;
+	class NamespaceInfo;
+	class StructClassInfo;
+	class EnumInfo;
+
+	/**
+	*	Flat, pointer-free description of the entity hierarchy of a FileParsingResult.
+	*	Entities are stored as nodes in a single contiguous array in depth-first order, parent/child links being 32-bit indices.
+	*	Nodes only locate entities relatively to their parent, so the index stays valid when the owning FileParsingResult is moved,
+	*	and can be copied or serialized as raw memory.
+	*
+	*	The entities themselves are not moved into per-type arenas: they stay in the containers of FileParsingResult,
+	*	NamespaceInfo and StructClassInfo, which code generators read directly. The per-type node lists give the same
+	*	contiguous access to all entities of a type without breaking that API.
+	*/
+	class FlatEntityIndex
+	{
+		public:
+			/** Index used to represent the absence of node (the parent of file level entities for example). */
+			static constexpr uint32	invalidIndex	= std::numeric_limits<uint32>::max();
+
+			struct Node
+			{
+				/** Index of the parent node, invalidIndex for file level entities. */
+				uint32		parent;
+
+				/** Index of the entity in the parent container matching its type (StructClassInfo::fields for a field for example). */
+				uint32		indexInParent;
+
+				/** Index following the last node of this node subtree. Nodes in [this + 1, subtreeEnd) are nested in this node. */
+				uint32		subtreeEnd;
+
+				/** Type of the entity. */
+				EEntityType	type;
+			};
+
+			static_assert(std::is_trivially_copyable_v<Node>, "FlatEntityIndex::Node must stay trivially copyable to be relocatable/serializable.");
+
+		private:
+			/** All nodes, in depth-first order. */
+			std::vector<Node>						_nodes;
+
+			/** Indices of the nodes of each entity type, in depth-first order. */
+			std::array<std::vector<uint32>, entityTypesCount>	_nodesPerType;
+
+			/**
+			*	@brief Get the index of a single-bit entity type in _nodesPerType.
+			*/
+			static size_t		getTypeIndex(EEntityType entityType)											noexcept;
+
+			/**
+			*	@brief Append a node and its subtree to _nodes.
+			*
+			*	@param type				Type of the entity.
+			*	@param parent			Index of the parent node.
+			*	@param indexInParent	Index of the entity in its parent container.
+			*
+			*	@return The index of the added node.
+			*/
+			uint32				addNode(EEntityType type, uint32 parent, uint32 indexInParent)					noexcept;
+
+			/**
+			*	@brief Add the nodes of all entities nested in a file or a namespace.
+			*/
+			template <typename ScopeType>
+			void				addScopeNodes(ScopeType const& scope, uint32 parent)							noexcept;
+
+			void				addNamespaceNodes(NamespaceInfo const& namespace_, uint32 parent, uint32 indexInParent)	noexcept;
+			void				addStructClassNodes(StructClassInfo const& struct_, uint32 parent, uint32 indexInParent)	noexcept;
+			void				addEnumNodes(EnumInfo const& enum_, uint32 parent, uint32 indexInParent)				noexcept;
+
+			/**
+			*	@brief	Get the entity of a node, nodes being resolved in increasing order.
+			*			Ancestors shared with the previously resolved node are not resolved again.
+			*
+			*	@param fileParsingResult	Parsing result the index has been built from.
+			*	@param nodeIndex			Index of the node to resolve, greater than the one of the previous call.
+			*	@param inout_ancestors		Ancestors of the previously resolved node with their entity, from the outermost one.
+			*								Updated to the ancestors of the resolved node.
+			*
+			*	@return The entity of the node.
+			*/
+			EntityInfo const&	resolveEntity(FileParsingResult const&							fileParsingResult,
+											  uint32											nodeIndex,
+											  std::vector<std::pair<uint32, EntityInfo const*>>&	inout_ancestors)	const	noexcept;
+
+		public:
+			/**
+			*	@brief Rebuild the index from the entities of a file parsing result.
+			*
+			*	@param fileParsingResult The indexed parsing result.
+			*/
+			void						build(FileParsingResult const& fileParsingResult)					noexcept;
+
+			/**
+			*	@brief Remove all nodes.
+			*/
+			void						clear()																noexcept;
+
+			/**
+			*	@brief Check whether the index contains any node.
+			*/
+			bool						empty()														const	noexcept;
+
+			/**
+			*	@brief Getter for _nodes.
+			*/
+			std::vector<Node> const&	getNodes()													const	noexcept;
+
+			/**
+			*	@brief Get the indices of all nodes of a given type.
+			*
+			*	@param entityType A single entity type (not a mask).
+			*
+			*	@return The indices of the nodes, in depth-first order.
+			*/
+			std::vector<uint32> const&	getNodesOfType(EEntityType entityType)						const	noexcept;
+
+			/**
+			*	@brief	Get the entity of a node from its parent entity.
+			*
+			*	@param fileParsingResult	Parsing result the index has been built from.
+			*	@param parentEntity			Entity of the node parent, nullptr for file level nodes.
+			*	@param node					The node to resolve.
+			*
+			*	@return The entity of the node.
+			*/
+			static EntityInfo const&	getEntity(FileParsingResult const&	fileParsingResult,
+												  EntityInfo const*			parentEntity,
+												  Node const&				node)								noexcept;
+
+			/**
+			*	@brief	Get the entity of a node by walking up its parents.
+			*			Prefer foreachEntityOfType to iterate over many entities.
+			*
+			*	@param fileParsingResult	Parsing result the index has been built from.
+			*	@param nodeIndex			Index of the node to resolve.
+			*
+			*	@return The entity of the node.
+			*/
+			EntityInfo const&			getEntity(FileParsingResult const&	fileParsingResult,
+												  uint32					nodeIndex)					const	noexcept;
+
+			/**
+			*	@brief	Check that the index visits the same entities in the same order as the entities tree traversal,
+			*			for each entity type and for all of them at once.
+			*
+			*	@param fileParsingResult Parsing result the index has been built from.
+			*
+			*	@return true if both traversals match, else false.
+			*/
+			bool						matchesTreeTraversal(FileParsingResult const& fileParsingResult)	const	noexcept;
+
+			/**
+			*	@brief	Call a visitor function on each entity of the provided type(s), in depth-first order.
+			*			Only the nodes of the requested types and their ancestors are resolved.
+			*
+			*	@param fileParsingResult	Parsing result the index has been built from.
+			*	@param entityMask			All types of entities the visitor function should be called on.
+			*	@param visitor				Function to call on entities.
+			*/
+			template <typename Functor, typename = std::enable_if_t<std::is_invocable_v<Functor, EntityInfo const&>>>
+			void						foreachEntityOfType(FileParsingResult const&	fileParsingResult,
+															EEntityType					entityMask,
+															Functor						visitor)				const	noexcept;
+	};
+
+	#include "Kodgen/Parsing/ParsingResults/FlatEntityIndex.inl"
+}
\ No newline at end of file
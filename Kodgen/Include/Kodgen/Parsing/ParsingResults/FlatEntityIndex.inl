@@ -0,0 +1,50 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename Functor, typename>
+void FlatEntityIndex::foreachEntityOfType(FileParsingResult const& fileParsingResult, EEntityType entityMask, Functor visitor) const noexcept
+{
+	//Node lists of the requested types, each sorted in depth-first order
+	std::array<std::vector<uint32> const*, entityTypesCount>	lists;
+	std::array<size_t, entityTypesCount>					positions{};
+	size_t													listsCount = 0u;
+
+	for (size_t i = 0u; i < entityTypesCount; i++)
+	{
+		if ((entityMask && static_cast<EEntityType>(1u << i)) && !_nodesPerType[i].empty())
+		{
+			lists[listsCount++] = &_nodesPerType[i];
+		}
+	}
+
+	std::vector<std::pair<uint32, EntityInfo const*>> ancestors;
+
+	while (true)
+	{
+		//Merge the lists to keep the depth-first order of the tree traversal
+		size_t	nextList	= listsCount;
+		uint32	nodeIndex	= invalidIndex;
+
+		for (size_t i = 0u; i < listsCount; i++)
+		{
+			if (positions[i] < lists[i]->size() && (*lists[i])[positions[i]] < nodeIndex)
+			{
+				nextList	= i;
+				nodeIndex	= (*lists[i])[positions[i]];
+			}
+		}
+
+		if (nextList == listsCount)
+		{
+			break;
+		}
+
+		positions[nextList]++;
+
+		visitor(resolveEntity(fileParsingResult, nodeIndex, ancestors));
+	}
+}
\ No newline at end of file
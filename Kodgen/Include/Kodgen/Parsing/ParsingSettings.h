@@ -11,6 +11,7 @@
 #include <string>
 
 #include "Kodgen/Properties/PropertyParsingSettings.h"
+#include "Kodgen/Parsing/EParsedData.h"
 #include "Kodgen/Misc/Settings.h"
 #include "Kodgen/Misc/Filesystem.h"
 #include "Kodgen/Misc/Optional.h"
@@ -31,6 +32,13 @@ namespace kodgen
 			*/
 			std::unordered_set<fs::path, PathHash>	_projectIncludeDirectories;
 
+			/**
+			*	Root directory of the project.
+			*	File ids are computed from the path of the parsed file relative to this directory,
+			*	so that generated files don't depend on the location of the checkout.
+			*/
+			fs::path								_projectRootDirectory;
+
 			/**
 			*	Name of the compiler used to compile the header files being parsed.
 			*	This is used to make sure the parser recognizes the included headers.
@@ -116,6 +124,15 @@ namespace kodgen
 			void	loadShouldAbortParsingOnFirstError(toml::value const&	parsingSettings,
 													   ILogger*				logger)			noexcept;
 
+			/**
+			*	@brief Load the parseTimeout setting from toml.
+			*
+			*	@param parsingSettings	Toml content.
+			*	@param logger			Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void	loadParseTimeout(toml::value const&	parsingSettings,
+									 ILogger*			logger)								noexcept;
+
 			/**
 			*	@brief	Load the _compilerExeName setting from toml.
 			*
@@ -135,6 +152,15 @@ namespace kodgen
 			void	loadProjectIncludeDirectories(toml::value const&	parsingSettings,
 												  ILogger*				logger)				noexcept;
 
+			/**
+			*	@brief	Load the _projectRootDirectory setting from toml.
+			*
+			*	@param parsingSettings	Toml content.
+			*	@param logger			Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void	loadProjectRootDirectory(toml::value const&	parsingSettings,
+											 ILogger*			logger)						noexcept;
+
 		protected:
 			virtual bool loadSettingsValues(toml::value const&	tomlData,
 											ILogger*			logger)		noexcept override;
@@ -189,6 +215,19 @@ namespace kodgen
 			*/
 			bool									shouldLogDiagnostic				= false;
 
+			/**
+			*	Maximum time (in seconds) libclang is allowed to spend on a single translation unit.
+			*	When the budget is exceeded, the file is abandoned, reported as timed out and the remaining files are processed normally.
+			*	A value <= 0 disables the watchdog.
+			*/
+			float									parseTimeout					= 0.0f;
+
+			/**
+			*	Optional data computed for each parsed entity.
+			*	CodeGenManager::run overwrites it with the data required by the modules of the code generation unit.
+			*/
+			EParsedData								parsedData						= EParsedData::All;
+
 			bool									shouldUsePch					= false;
 			fs::path								pchPath;
 
@@ -232,6 +271,23 @@ namespace kodgen
 			*/
 			std::unordered_set<fs::path, PathHash> const&	getProjectIncludeDirectories()						const	noexcept;
 
+			/**
+			*	@brief	Set the project root directory, against which the stable file ids are computed.
+			*			If the provided path is invalid or is not a directory, do nothing.
+			*	
+			*	@param directoryPath Path to the project root directory.
+			*
+			*	@return true if the project root directory was updated, else false.
+			*/
+			bool											setProjectRootDirectory(fs::path const& directoryPath)		noexcept;
+
+			/**
+			*	@brief Getter for _projectRootDirectory field.
+			*	
+			*	@return _projectRootDirectory;
+			*/
+			fs::path const&									getProjectRootDirectory()							const	noexcept;
+
 			/**
 			*	@brief Getter for _compilerExeName field.
 			*	
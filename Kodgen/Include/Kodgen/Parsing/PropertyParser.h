@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <string_view>
+
 #include "Kodgen/InfoStructures/EntityInfo.h"
 #include "Kodgen/Properties/PropertyParsingSettings.h"
 #include "Kodgen/Misc/Optional.h"
@@ -22,93 +24,79 @@ namespace kodgen
 			/** Last parsing error which occured when parsing from this parser. */
 			std::string								_parsingErrorDescription	= "";
 
-			/** Collection of last parsed split properties. */
-			std::vector<std::vector<std::string>>	_splitProps;
-
 			/** Chars to take into consideration when parsing a property. */
 			std::string								_relevantCharsForPropParsing;
 
 			/** Chars to take into consideration when parsing property arguments. */
 			std::string								_relevantCharsForPropArgsParsing;
 
+			/** Time elapsed (in seconds) parsing properties since the last setup call. */
+			float									_parsingDuration	= 0.0f;
+
 			/**
-			*	@brief	Split properties and fill _splitProps on success.
+			*	@brief	Split properties in a single pass and append them to out_properties.
 			*			On failure, _parsingErrorDescription is updated.
 			*
-			*	@param propertiesString String containing the properties to split.
+			*	@param propertiesString	String containing the properties to split.
+			*	@param out_properties	List the parsed properties are appended to.
 			*
 			*	@return true on a successful split, else false.
 			*/
-			bool									splitProperties(std::string&& propertiesString)							noexcept;
-
-			/**
-			*	@brief Remove all starting space characters.
-			*
-			*	@param toCleanString The string to clean.
-			*/
-			void									removeStartSpaces(std::string& toCleanString)					const	noexcept;
-
-			/**
-			*	@brief Remove all trailing space characters.
-			*
-			*	@param toCleanString The string to clean.
-			*/
-			void									removeTrailSpaces(std::string& toCleanString)					const	noexcept;
+			bool									splitProperties(std::string_view		propertiesString,
+																	std::vector<Property>&	out_properties)			noexcept;
 
 			/**
-			*	@brief	Search the next property.
-			*			inout_parsingProps will be updated to the current parsing state and out_isParsingArgument is updated consequently.
+			*	@brief	Search the next property from inout_index.
+			*			inout_index is moved past the consumed characters and out_isParsingArgument is updated consequently.
 			*
-			*	@param inout_parsingProps		The string we are looking the next prop in.
+			*	@param propertiesString			The string we are looking the next prop in.
+			*	@param inout_index				Index of the first unparsed character of propertiesString.
 			*	@param out_isParsingArgument	Updated by this function call to indicate either the processed prop has following arguments or not.
+			*	@param out_properties			List the property is added to.
 			*
-			*	@return true & add the property to _splitProps (new vector) on success, else return false.
+			*	@return true on success, else false.
 			*/
-			bool									lookForNextProperty(std::string&	inout_parsingProps,
-																		bool&			out_isParsingArgument)				noexcept;
+			bool									lookForNextProperty(std::string_view		propertiesString,
+																		size_t&					inout_index,
+																		bool&					out_isParsingArgument,
+																		std::vector<Property>&	out_properties)		noexcept;
 
 			/**
-			*	@brief	Search the next property argument.
-			*			inout_parsingProps will be updated to the current parsing state and out_isParsingArgument is updated consequently.
+			*	@brief	Search the next property argument from inout_index.
+			*			inout_index is moved past the consumed characters and out_isParsingArgument is updated consequently.
 			*
-			*	@param inout_parsingProps		The string we are looking the next prop in.
+			*	@param propertiesString			The string we are looking the next argument in.
+			*	@param inout_index				Index of the first unparsed character of propertiesString.
 			*	@param out_isParsingArgument	Filled by this function call to indicate either the processed prop has following arguments or not.
+			*	@param inout_property			Property the argument is added to.
 			*
-			*	@return true & add the argument to _splitProps (last added vector) on success, else return false.
+			*	@return true on success, else false.
 			*/
-			bool									lookForNextPropertyArgument(std::string&	inout_parsingProps,
-																				bool&			out_isParsingArgument)		noexcept;
+			bool									lookForNextPropertyArgument(std::string_view	propertiesString,
+																				size_t&				inout_index,
+																				bool&				out_isParsingArgument,
+																				Property&			inout_property)	noexcept;
 
 			/**
-			*	@brief	Create a list of properties based on the parsed properties
-			*	
-			*	@param splitProps The collection of all parsed props / arguments.
+			*	@brief Remove all starting and trailing space characters.
 			*
-			*	@return A list of properties.
-			*/
-			std::vector<Property>					fillProperties(std::vector<std::vector<std::string>>& splitProps)		noexcept;
-
-			/**
-			*	@brief Add a property to the given property group using the provided data.
+			*	@param toTrimString The string to trim.
 			*
-			*	@param propertyAsVector	Vector of properties. Element 0 is the property name, next elements are associated arguments.
-			*	@param out_properties	List of properties to update.
+			*	@return The trimmed string.
 			*/
-			void									addProperty(std::vector<std::string>&	propertyAsVector,
-																std::vector<Property>&		out_properties)					noexcept;
+			static std::string_view					trimSpaces(std::string_view toTrimString)								noexcept;
 
 			/**
 			*	@brief Retrieve properties from a string if possible.
 			*
 			*	@param annotateMessage	The raw string contained in the __attribute__(annotate()) preprocessor.
 			*	@param annotationId		The annotation the annotate message should begin with to be considered as valid.
-			*	@param entityType		The type of the attached entity.
 			*
 			*	@return A valid optional object if all properties were valid, else an empty optional.
 			*			On failure, _parsingErrorDescription is updated.
 			*/
-			opt::optional<std::vector<Property>>	getProperties(std::string&&			annotateMessage,
-																  std::string const&	annotationId)						noexcept;
+			opt::optional<std::vector<Property>>	getProperties(std::string_view	annotateMessage,
+																  std::string_view	annotationId)						noexcept;
 
 		public:
 			/**
@@ -119,10 +107,17 @@ namespace kodgen
 			void									setup(PropertyParsingSettings const& propertyParsingSettings)	noexcept;
 
 			/**
-			*	@brief	Clear all collected data such as parsingErrors or split props. Called to have a clean state and prepare to parse new properties.
+			*	@brief	Clear all collected data such as parsingErrors. Called to have a clean state and prepare to parse new properties.
 			*/
 			void									clean()															noexcept;
 
+			/**
+			*	@brief Getter for _parsingDuration field.
+			* 
+			*	@return Time elapsed (in seconds) parsing properties since the last setup call.
+			*/
+			float									getParsingDuration()									const	noexcept;
+
 			/**
 			*	@brief Retrieve the properties from a namespace annotate attribute.
 			*
@@ -0,0 +1,48 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <atomic>
+
+namespace kodgen
+{
+	class CancellationToken
+	{
+		private:
+			/** Has a cancellation been requested? */
+			std::atomic_bool	_isCancelled	= false;
+
+		public:
+			CancellationToken()											= default;
+			CancellationToken(CancellationToken const&)					= delete;
+			CancellationToken(CancellationToken&&)						= delete;
+			~CancellationToken()										= default;
+
+			/**
+			*	@brief Request the cancellation of all work observing this token.
+			*/
+			inline void	cancel()						noexcept;
+
+			/**
+			*	@brief Clear any previous cancellation request so that the token can be reused.
+			*/
+			inline void	reset()							noexcept;
+
+			/**
+			*	@brief Check whether a cancellation has been requested.
+			* 
+			*	@return true if cancel() has been called since the last reset, else false.
+			*/
+			inline bool	isCancelled()			const	noexcept;
+
+			CancellationToken& operator=(CancellationToken const&)		= delete;
+			CancellationToken& operator=(CancellationToken&&)			= delete;
+	};
+
+	#include "Kodgen/Threading/CancellationToken.inl"
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline void CancellationToken::cancel() noexcept
+{
+	_isCancelled.store(true, std::memory_order_relaxed);
+}
+
+inline void CancellationToken::reset() noexcept
+{
+	_isCancelled.store(false, std::memory_order_relaxed);
+}
+
+inline bool CancellationToken::isCancelled() const noexcept
+{
+	return _isCancelled.load(std::memory_order_relaxed);
+}
\ No newline at end of file
@@ -21,6 +21,9 @@ namespace kodgen
 			/** Name of the task. */
 			std::string	_name;
 
+			/** Optional description of the task (processed file for example), used when tracing tasks. */
+			std::string	_description;
+
 		protected:
 			/** Dependent tasks which must terminate before this task is executed. */
 			std::vector<std::shared_ptr<TaskBase>>	dependencies;
@@ -60,6 +63,21 @@ namespace kodgen
 			*/
 			std::string const&	getName()			const	noexcept;
 
+			/**
+			*	@brief Getter for _description field.
+			* 
+			*	@return _description field.
+			*/
+			std::string const&	getDescription()	const	noexcept;
+
+			/**
+			*	@brief	Setter for _description field.
+			*			It must be called before the task starts executing.
+			* 
+			*	@param description The new description of the task.
+			*/
+			void				setDescription(std::string description)	noexcept;
+
 			TaskBase& operator=(TaskBase const&)	= default;
 			TaskBase& operator=(TaskBase&&)			= default;
 	};
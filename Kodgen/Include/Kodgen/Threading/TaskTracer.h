@@ -0,0 +1,103 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <chrono>
+
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	class TaskTracer
+	{
+		public:
+			using Clock		= std::chrono::steady_clock;
+			using TimePoint	= Clock::time_point;
+
+		private:
+			struct Event
+			{
+				/** Name of the traced event, usually the task name. */
+				std::string		name;
+
+				/** Category of the event, used by trace viewers to filter events. */
+				std::string		category;
+
+				/** Additional information about the event (processed file path for example). Can be empty. */
+				std::string		detail;
+
+				/** Thread the event occured on. */
+				std::thread::id	threadId;
+
+				/** Time at which the event started. */
+				TimePoint		begin;
+
+				/** Time at which the event ended. */
+				TimePoint		end;
+			};
+
+			/** Reference time point all event timestamps are relative to. */
+			TimePoint			_origin;
+
+			/** All recorded events. */
+			std::vector<Event>	_events;
+
+			/** Mutex used to record events from multiple threads. */
+			mutable std::mutex	_eventsMutex;
+
+		public:
+			TaskTracer()					noexcept;
+			TaskTracer(TaskTracer const&)	= delete;
+			TaskTracer(TaskTracer&&)		= delete;
+			~TaskTracer()					= default;
+
+			/**
+			*	@brief Record an event which ran on the calling thread. Thread-safe.
+			* 
+			*	@param name		Name of the event.
+			*	@param category	Category of the event.
+			*	@param detail	Additional information about the event. Can be empty.
+			*	@param begin	Time at which the event started.
+			*	@param end		Time at which the event ended.
+			*/
+			void		recordEvent(std::string		name,
+									std::string		category,
+									std::string		detail,
+									TimePoint		begin,
+									TimePoint		end)						noexcept;
+
+			/**
+			*	@brief Remove all recorded events and reset the reference time point.
+			*/
+			void		clear()												noexcept;
+
+			/**
+			*	@brief Serialize all recorded events to the Chrome Trace Event format (readable by about:tracing or Perfetto).
+			* 
+			*	@return The trace as a JSON string.
+			*/
+			std::string	getChromeTraceJson()						const	noexcept;
+
+			/**
+			*	@brief Write all recorded events to the provided file in the Chrome Trace Event format.
+			* 
+			*	@param outputFile Path to the file to write. It is overwritten if it already exists.
+			* 
+			*	@return true if the file could be written, else false.
+			*/
+			bool		exportChromeTrace(fs::path const& outputFile)	const	noexcept;
+
+			TaskTracer& operator=(TaskTracer const&)	= delete;
+			TaskTracer& operator=(TaskTracer&&)			= delete;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace kodgen
+{
+	/**
+	*	Owns threads which can't be joined right away by the code starting them,
+	*	like the parsings abandoned after ParsingSettings::parseTimeout, so that they never outlive their owner.
+	*/
+	class ThreadJoiner
+	{
+		private:
+			/** Mutex used to synchronize the threads adoption and joins. */
+			std::mutex					_mutex;
+
+			/** Threads to join. */
+			std::vector<std::thread>	_threads;
+
+		public:
+			ThreadJoiner()										= default;
+			ThreadJoiner(ThreadJoiner const&)					= delete;
+			ThreadJoiner(ThreadJoiner&&)						= delete;
+			~ThreadJoiner()										noexcept;
+
+			/**
+			*	@brief Take the ownership of a thread, which is joined by the next joinAll call.
+			*
+			*	@param thread Thread to own. Not joinable threads are ignored.
+			*/
+			void	adopt(std::thread&& thread)	noexcept;
+
+			/**
+			*	@brief Wait for all the adopted threads to finish.
+			*/
+			void	joinAll()					noexcept;
+
+			ThreadJoiner& operator=(ThreadJoiner const&)		= delete;
+			ThreadJoiner& operator=(ThreadJoiner&&)				= delete;
+	};
+}
\ No newline at end of file
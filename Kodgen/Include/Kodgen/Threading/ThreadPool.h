@@ -20,6 +20,7 @@
 
 #include "Kodgen/Threading/Task.h"
 #include "Kodgen/Threading/ETerminationMode.h"
+#include "Kodgen/Threading/TaskTracer.h"
 #include "Kodgen/Misc/FundamentalTypes.h"
 
 namespace kodgen
@@ -48,6 +49,9 @@ namespace kodgen
 			/** Number of workers currently running a task. */
 			std::atomic_uint						_workingWorkers;
 
+			/** Tracer recording the execution of each task. Can be nullptr. */
+			std::atomic<TaskTracer*>				_taskTracer	= nullptr;
+
 			/**
 			*	@brief Routine run by workers.
 			*/
@@ -104,6 +108,13 @@ namespace kodgen
 			*/
 			void						setIsRunning(bool isRunning)									noexcept;
 
+			/**
+			*	@brief Set the tracer recording the begin/end of each executed task.
+			* 
+			*	@param taskTracer The tracer to use, or nullptr to disable tracing.
+			*/
+			void						setTaskTracer(TaskTracer* taskTracer)							noexcept;
+
 			ThreadPool& operator=(ThreadPool const&)	= delete;
 			ThreadPool& operator=(ThreadPool&&)			= delete;
 	};
@@ -14,12 +14,23 @@ std::set<fs::path> CodeGenManager::identifyFilesToProcess(CodeGenUnit const& cod
 {
 	std::set<fs::path> result;
 
+	//Wrap the up-to-date check to measure the time spent in it
+	auto isUpToDate = [&codeGenUnit, &out_genResult](fs::path const& file) -> bool
+	{
+		auto start		= std::chrono::steady_clock::now();
+		bool upToDate	= codeGenUnit.isUpToDate(file);
+
+		out_genResult.upToDateCheckDuration += std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+		return upToDate;
+	};
+
 	//Iterate over all "toParseFiles"
 	for (fs::path path : settings.getToProcessFiles())
 	{
 		if (fs::exists(path) && !fs::is_directory(path))
 		{
-			if (!codeGenUnit.isUpToDate(path) || forceRegenerateAll)
+			if (!isUpToDate(path) || forceRegenerateAll)
 			{
 				result.emplace(path);
 			}
@@ -51,7 +62,7 @@ std::set<fs::path> CodeGenManager::identifyFilesToProcess(CodeGenUnit const& cod
 					{
 						if (settings.isSupportedFileExtension(entry.path().extension()) && !settings.isIgnoredFile(entry.path()))
 						{
-							if (!codeGenUnit.isUpToDate(entry.path()) || forceRegenerateAll)
+							if (!isUpToDate(entry.path()) || forceRegenerateAll)
 							{
 								result.emplace(entry.path());
 							}
@@ -98,7 +109,8 @@ uint32 CodeGenManager::getThreadCount(uint32 initialThreadCount) const noexcept
 
 void CodeGenManager::generateMacrosFile(ParsingSettings const& parsingSettings, fs::path const& outputDirectory) const noexcept
 {
-	GeneratedFile macrosDefinitionFile(outputDirectory / CodeGenUnitSettings::entityMacrosFilename);
+	//Generated files include the macros file, so leave it untouched when it is up-to-date to keep incremental builds incremental
+	GeneratedFile macrosDefinitionFile(outputDirectory / CodeGenUnitSettings::entityMacrosFilename, fs::path(), true);
 
 	macrosDefinitionFile.writeLines("#pragma once",
 									"");
@@ -150,4 +162,20 @@ bool CodeGenManager::checkGenerationSetup(FileParser const& /* fileParser */, Co
 	}
 	
 	return codeGenUnit.checkSettings();
+}
+
+void CodeGenManager::logStructLayoutWarnings(CodeGenResult const& genResult) const noexcept
+{
+	if (logger == nullptr)
+	{
+		return;
+	}
+
+	for (StructLayout const& layout : genResult.structLayouts)
+	{
+		if (layout.getPaddingSize() >= settings.structLayoutPaddingWarningThreshold || layout.getStraddlingFieldsCount() != 0u)
+		{
+			logger->log("[Layout] " + layout.file.string() + ": " + layout.getSummary(), ILogger::ELogSeverity::Warning);
+		}
+	}
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "Kodgen/Misc/TomlUtility.h"
 #include "Kodgen/Misc/ILogger.h"
+#include "Kodgen/Misc/Helpers.h"
 
 using namespace kodgen;
 
@@ -40,6 +41,7 @@ bool CodeGenManagerSettings::loadSettingsValues(toml::value const& tomlData, ILo
 		loadToProcessDirectories(tomlGeneratorSettings, logger);
 		loadIgnoredFiles(tomlGeneratorSettings, logger);
 		loadIgnoredDirectories(tomlGeneratorSettings, logger);
+		loadStructLayoutSettings(tomlGeneratorSettings, logger);
 
 		return true;
 	}
@@ -345,4 +347,17 @@ std::unordered_set<fs::path, PathHash> const& CodeGenManagerSettings::getIgnored
 std::unordered_set<std::string> const& CodeGenManagerSettings::getSupportedExtensions() const noexcept
 {
 	return _supportedFileExtensions;
+}
+
+void CodeGenManagerSettings::loadStructLayoutSettings(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(generationSettings, "shouldAnalyzeStructLayouts", shouldAnalyzeStructLayouts, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load shouldAnalyzeStructLayouts: " + Helpers::toString(shouldAnalyzeStructLayouts));
+	}
+
+	if (TomlUtility::updateSetting(generationSettings, "structLayoutPaddingWarningThreshold", structLayoutPaddingWarningThreshold, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load structLayoutPaddingWarningThreshold: " + std::to_string(structLayoutPaddingWarningThreshold));
+	}
 }
\ No newline at end of file
@@ -18,6 +18,11 @@ int32 CodeGenModule::getGenerationOrder() const noexcept
 	return (*it)->getIterationCount();
 }
 
+EParsedData CodeGenModule::getRequiredParsedData() const noexcept
+{
+	return EParsedData::All;
+}
+
 ETraversalBehaviour CodeGenModule::generateCodeForEntity(EntityInfo const& entity, CodeGenEnv& env, std::string& inout_result, void const* /* data */) noexcept
 {
 	return generateCodeForEntity(entity, env, inout_result);
@@ -46,7 +51,7 @@ ETraversalBehaviour CodeGenModule::callVisitorOnEntity(EntityInfo const& entity,
 {
 	assert(visitor != nullptr);
 
-	return visitor(*this, entity, env, nullptr);
+	return visitEntity(entity, env, visitor);
 }
 
 std::vector<PropertyCodeGen*> const& CodeGenModule::getPropertyCodeGenerators() const noexcept
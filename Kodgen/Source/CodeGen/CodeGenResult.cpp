@@ -1,11 +1,203 @@
 #include "Kodgen/CodeGen/CodeGenResult.h"
 
+#include "Kodgen/Misc/Helpers.h"
+
+#include <map>
+#include <algorithm>	//std::sort
+#include <cmath>		//std::ceil
+#include <functional>	//std::function
+#include <sstream>
+
 using namespace kodgen;
 
+namespace
+{
+	/**
+	*	@brief Compute the p50/p90/p99/max/total statistics of the provided durations and serialize them to JSON.
+	*
+	*	@param durations The durations (in seconds) to compute the statistics of.
+	*
+	*	@return The statistics as a JSON object.
+	*/
+	std::string getStatisticsAsJson(std::vector<float> durations) noexcept
+	{
+		float total = 0.0f;
+
+		for (float duration : durations)
+		{
+			total += duration;
+		}
+
+		std::sort(durations.begin(), durations.end());
+
+		//Nearest-rank percentile
+		auto percentile = [&durations](float rank) -> float
+		{
+			if (durations.empty())
+			{
+				return 0.0f;
+			}
+
+			size_t index = static_cast<size_t>(std::ceil(rank * static_cast<float>(durations.size())));
+
+			return durations[(index == 0u) ? 0u : std::min(index, durations.size()) - 1u];
+		};
+
+		std::ostringstream stream;
+
+		stream	<< "{\"p50\":" << percentile(0.5f)
+				<< ",\"p90\":" << percentile(0.9f)
+				<< ",\"p99\":" << percentile(0.99f)
+				<< ",\"max\":" << (durations.empty() ? 0.0f : durations.back())
+				<< ",\"total\":" << total << "}";
+
+		return stream.str();
+	}
+}
+
 void CodeGenResult::mergeResult(CodeGenResult&& otherResult) noexcept
 {
 	parsedFiles.insert(parsedFiles.cend(), std::make_move_iterator(otherResult.parsedFiles.cbegin()), std::make_move_iterator(otherResult.parsedFiles.cend()));
 	upToDateFiles.insert(upToDateFiles.cend(), std::make_move_iterator(otherResult.upToDateFiles.cbegin()), std::make_move_iterator(otherResult.upToDateFiles.cend()));
+	timedOutFiles.insert(timedOutFiles.cend(), std::make_move_iterator(otherResult.timedOutFiles.cbegin()), std::make_move_iterator(otherResult.timedOutFiles.cend()));
+	fileTimings.insert(fileTimings.cend(), std::make_move_iterator(otherResult.fileTimings.begin()), std::make_move_iterator(otherResult.fileTimings.end()));
+	structLayouts.insert(structLayouts.cend(), std::make_move_iterator(otherResult.structLayouts.begin()), std::make_move_iterator(otherResult.structLayouts.end()));
+
+	scanDuration			+= otherResult.scanDuration;
+	upToDateCheckDuration	+= otherResult.upToDateCheckDuration;
 
 	completed &= otherResult.completed;
+}
+
+std::string CodeGenResult::getTimingsAsJson() const noexcept
+{
+	std::ostringstream stream;
+
+	//Run-level phases
+	stream	<< "{\"duration\":" << duration
+			<< ",\"scan\":" << scanDuration
+			<< ",\"upToDateCheck\":" << upToDateCheckDuration;
+
+	//Aggregated per-file phases
+	auto collectDurations = [this](std::function<float(FileTimings const&)> getter) -> std::vector<float>
+	{
+		std::vector<float> result;
+		result.reserve(fileTimings.size());
+
+		for (FileTimings const& timings : fileTimings)
+		{
+			result.push_back(getter(timings));
+		}
+
+		return result;
+	};
+
+	stream	<< ",\"phases\":{"
+			<< "\"parse\":"				<< getStatisticsAsJson(collectDurations([](FileTimings const& timings) { return timings.parsingDuration; }))
+			<< ",\"traversal\":"		<< getStatisticsAsJson(collectDurations([](FileTimings const& timings) { return timings.traversalDuration; }))
+			<< ",\"propertyParsing\":"	<< getStatisticsAsJson(collectDurations([](FileTimings const& timings) { return timings.propertyParsingDuration; }))
+			<< ",\"write\":"			<< getStatisticsAsJson(collectDurations([](FileTimings const& timings) { return timings.writeDuration; }))
+			<< "}";
+
+	//Aggregated code generators
+	std::map<std::string, std::vector<float>> codeGenDurations;
+
+	for (FileTimings const& timings : fileTimings)
+	{
+		for (auto const& [codeGenName, codeGenDuration] : timings.codeGenDurations)
+		{
+			codeGenDurations[codeGenName].push_back(codeGenDuration);
+		}
+	}
+
+	stream << ",\"codeGenerators\":{";
+
+	for (auto it = codeGenDurations.cbegin(); it != codeGenDurations.cend(); it++)
+	{
+		stream << ((it == codeGenDurations.cbegin()) ? "" : ",") << Helpers::toJsonString(it->first) << ":" << getStatisticsAsJson(it->second);
+	}
+
+	stream << "}";
+
+	//Detailed timings of each file
+	stream << ",\"files\":[";
+
+	for (size_t i = 0u; i < fileTimings.size(); i++)
+	{
+		FileTimings const& timings = fileTimings[i];
+
+		stream	<< ((i == 0u) ? "" : ",")
+				<< "{\"path\":"				<< Helpers::toJsonString(timings.file.string())
+				<< ",\"parse\":"			<< timings.parsingDuration
+				<< ",\"traversal\":"		<< timings.traversalDuration
+				<< ",\"propertyParsing\":"	<< timings.propertyParsingDuration
+				<< ",\"write\":"			<< timings.writeDuration
+				<< ",\"codeGenerators\":{";
+
+		for (size_t j = 0u; j < timings.codeGenDurations.size(); j++)
+		{
+			stream << ((j == 0u) ? "" : ",") << Helpers::toJsonString(timings.codeGenDurations[j].first) << ":" << timings.codeGenDurations[j].second;
+		}
+
+		stream << "}}";
+	}
+
+	stream << "]}";
+
+	return stream.str();
+}
+
+std::string CodeGenResult::getStructLayoutsAsJson() const noexcept
+{
+	std::ostringstream stream;
+
+	stream << "{\"cacheLineSize\":" << StructLayout::cacheLineSize << ",\"structs\":[";
+
+	for (size_t i = 0u; i < structLayouts.size(); i++)
+	{
+		StructLayout const& layout = structLayouts[i];
+
+		stream	<< ((i == 0u) ? "" : ",")
+				<< "{\"name\":"			<< Helpers::toJsonString(layout.name)
+				<< ",\"file\":"			<< Helpers::toJsonString(layout.file.string())
+				<< ",\"size\":"			<< layout.size
+				<< ",\"alignment\":"		<< layout.alignment
+				<< ",\"padding\":"		<< layout.getPaddingSize()
+				<< ",\"suggestedSize\":"	<< layout.suggestedSize
+				<< ",\"fields\":[";
+
+		for (size_t j = 0u; j < layout.fields.size(); j++)
+		{
+			StructLayout::Field const& field = layout.fields[j];
+
+			stream	<< ((j == 0u) ? "" : ",")
+					<< "{\"name\":"					<< Helpers::toJsonString(field.name)
+					<< ",\"type\":"					<< Helpers::toJsonString(field.typeName)
+					<< ",\"offset\":"				<< field.offset
+					<< ",\"size\":"					<< field.size
+					<< ",\"alignment\":"			<< field.alignment
+					<< ",\"straddlesCacheLine\":"	<< (field.straddlesCacheLine ? "true" : "false")
+					<< "}";
+		}
+
+		stream << "],\"paddingHoles\":[";
+
+		for (size_t j = 0u; j < layout.paddingHoles.size(); j++)
+		{
+			stream << ((j == 0u) ? "" : ",") << "{\"offset\":" << layout.paddingHoles[j].offset << ",\"size\":" << layout.paddingHoles[j].size << "}";
+		}
+
+		stream << "],\"suggestedOrder\":[";
+
+		for (size_t j = 0u; j < layout.suggestedOrder.size(); j++)
+		{
+			stream << ((j == 0u) ? "" : ",") << Helpers::toJsonString(layout.suggestedOrder[j]);
+		}
+
+		stream << "]}";
+	}
+
+	stream << "]}";
+
+	return stream.str();
 }
\ No newline at end of file
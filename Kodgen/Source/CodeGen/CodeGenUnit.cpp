@@ -2,19 +2,6 @@
 
 #include <algorithm>
 
-#include "Kodgen/CodeGen/CodeGenHelpers.h"
-#include "Kodgen/CodeGen/PropertyCodeGen.h"
-
-#define HANDLE_NESTED_ENTITY_ITERATION_RESULT(result)																\
-	if (result == ETraversalBehaviour::Break)																		\
-	{																												\
-		break;																										\
-	}																												\
-	else if (result == ETraversalBehaviour::AbortWithFailure || result == ETraversalBehaviour::AbortWithSuccess)	\
-	{																												\
-		return result;																								\
-	}
-
 using namespace kodgen;
 
 CodeGenUnit::CodeGenUnit(CodeGenUnit const& other) noexcept:
@@ -26,8 +13,10 @@ CodeGenUnit::CodeGenUnit(CodeGenUnit const& other) noexcept:
 	//each CodeGenUnit instance owns their own modules
 	for (size_t i = 0; i < other._generationModules.size(); i++)
 	{
-		addModule(*static_cast<CodeGenModule*>(other._generationModules[i]->clone()));
+		_generationModules.emplace_back(static_cast<CodeGenModule*>(other._generationModules[i]->clone()));
 	}
+
+	refreshCodeGenerators();
 }
 
 CodeGenUnit::~CodeGenUnit() noexcept
@@ -101,56 +90,22 @@ bool CodeGenUnit::isFileNewerThan(fs::path const& file, fs::path const& referenc
 	return fs::last_write_time(file) > fs::last_write_time(referenceFile);
 }
 
-bool CodeGenUnit::generateCode(FileParsingResult const& parsingResult) noexcept
+bool CodeGenUnit::generateCode(FileParsingResult const& parsingResult, FileTimings* out_timings) noexcept
 {
-	//TODO: Should probably use std::unique_ptr here instead of a raw pointer to be exception-safe
-	CodeGenEnv* env = createCodeGenEnv();
-	
-	//If you assert/crash here, means the createCodeGenEnv method returned nullptr
-	//Check the implementation in the CodeGenUnit you use.
-	assert(env != nullptr);
-
-	//Pre-generation step
-	bool result = preGenerateCode(parsingResult, *env);
-
-	//Generation step (per module/entity pair), runs only if the pre-generation step succeeded
-	if (result)
-	{
-		std::vector<ICodeGenerator*> const& codeGenerators = getSortedCodeGenerators();
-
-		//Call initialGenerateCode on all ICodeGenerators first
-		initialGenerateCodeInternal(codeGenerators, *env);
-
-		if (result)
-		{
-			//Iterate over each module and entity and generate code
-			result &= foreachCodeGenEntityPair(std::bind(&CodeGenUnit::generateCodeForEntityInternal, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4), *env) != ETraversalBehaviour::AbortWithFailure;
-
-			if (result)
-			{
-				//Final call to generate code with a nullptr entity
-				finalGenerateCodeInternal(codeGenerators, *env);
-
-				//Post-generation step, runs only if all previous steps succeeded
-				if (result)
-				{
-					result &= postGenerateCode(*env);
-				}
-			}
-		}
-	}
-
-	delete env;
-
-	return result;
+	return generateCodeInternal<CodeGenUnit>(parsingResult, out_timings);
 }
 
-bool CodeGenUnit::initialGenerateCodeInternal(std::vector<ICodeGenerator*> const& codeGenerators, CodeGenEnv& env) noexcept
+bool CodeGenUnit::initialGenerateCodeInternal(std::vector<ICodeGenerator*> const& codeGenerators, CodeGenEnv& env, std::vector<float>& inout_durations) noexcept
 {
 	bool result = true;
 
-	for (ICodeGenerator* codeGenerator : codeGenerators)
+	for (size_t i = 0u; i < codeGenerators.size(); i++)
 	{
+		ICodeGenerator*	codeGenerator	= codeGenerators[i];
+		auto			start			= std::chrono::steady_clock::now();
+
+		env._codeGeneratorIndex = static_cast<uint32>(i);
+
 		auto generateLambda = [&result, codeGenerator](CodeGenEnv& env, std::string& inout_result)
 		{
 			result &= codeGenerator->initialGenerateCode(env, inout_result);
@@ -158,17 +113,24 @@ bool CodeGenUnit::initialGenerateCodeInternal(std::vector<ICodeGenerator*> const
 
 		//Result will be altered when generateLambda will be called from the CodeGenUnit::initialGenerateCode override
 		initialGenerateCode(env, generateLambda);
+
+		inout_durations[i] += std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
 	}
 	
 	return result;
 }
 
-bool CodeGenUnit::finalGenerateCodeInternal(std::vector<ICodeGenerator*> const& codeGenerators, CodeGenEnv& env) noexcept
+bool CodeGenUnit::finalGenerateCodeInternal(std::vector<ICodeGenerator*> const& codeGenerators, CodeGenEnv& env, std::vector<float>& inout_durations) noexcept
 {
 	bool result = true;
 
-	for (ICodeGenerator* codeGenerator : codeGenerators)
+	for (size_t i = 0u; i < codeGenerators.size(); i++)
 	{
+		ICodeGenerator*	codeGenerator	= codeGenerators[i];
+		auto			start			= std::chrono::steady_clock::now();
+
+		env._codeGeneratorIndex = static_cast<uint32>(i);
+
 		auto generateLambda = [&result, codeGenerator](CodeGenEnv& env, std::string& inout_result)
 		{
 			result &= codeGenerator->finalGenerateCode(env, inout_result);
@@ -176,22 +138,9 @@ bool CodeGenUnit::finalGenerateCodeInternal(std::vector<ICodeGenerator*> const&
 
 		//Result will be altered when generateLambda will be called from the CodeGenUnit::initialGenerateCode override
 		finalGenerateCode(env, generateLambda);
-	}
-
-	return result;
-}
-
-ETraversalBehaviour	CodeGenUnit::generateCodeForEntityInternal(ICodeGenerator& codeGenerator, EntityInfo const& entity, CodeGenEnv& env, void const* data) noexcept
-{
-	ETraversalBehaviour result = CodeGenHelpers::leastPrioritizedTraversalBehaviour;
-
-	auto generateLambda = [&result, &codeGenerator, &data](EntityInfo const& entity, CodeGenEnv& env, std::string& inout_result)
-	{
-		result = CodeGenHelpers::combineTraversalBehaviours(result, codeGenerator.generateCodeForEntity(entity, env, inout_result, data));
-	};
 
-	//Result will be altered when generateLambda will be called from the CodeGenUnit::generateCodeForEntity override
-	generateCodeForEntity(entity, env, generateLambda);
+		inout_durations[i] += std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+	}
 
 	return result;
 }
@@ -208,232 +157,138 @@ void CodeGenUnit::sortedInsert(std::vector<ICodeGenerator*>& vector, ICodeGenera
 	);
 }
 
-std::vector<ICodeGenerator*> CodeGenUnit::getSortedCodeGenerators() const noexcept
+std::vector<ICodeGenerator*> const& CodeGenUnit::getSortedCodeGenerators() const noexcept
+{
+	return _sortedCodeGenerators;
+}
+
+void CodeGenUnit::refreshCodeGenerators() noexcept
 {
-	std::vector<ICodeGenerator*> result;
+	_sortedCodeGenerators.clear();
+	_eligibleEntityMasks.clear();
+	_propertyCodeGeneratorsPerName.clear();
+
+	for (std::vector<uint32>& codeGenerators : _unboundCodeGeneratorsPerEntityType)
+	{
+		codeGenerators.clear();
+	}
 
 	//Insert all code gen modules
 	for (CodeGenModule* codeGenModule : _generationModules)
 	{
-		sortedInsert(result, *codeGenModule);
+		sortedInsert(_sortedCodeGenerators, *codeGenModule);
 
 		//Insert all property code gens contained in code gen modules
 		for (PropertyCodeGen* propertyCodeGen : codeGenModule->getPropertyCodeGenerators())
 		{
-			sortedInsert(result, *propertyCodeGen);
+			sortedInsert(_sortedCodeGenerators, *propertyCodeGen);
 		}
 	}
 
-	return result;
-}
+	//Bind property code gens to their property name
+	std::vector<bool> isBoundToProperty(_sortedCodeGenerators.size(), false);
 
-CodeGenEnv* CodeGenUnit::createCodeGenEnv() const noexcept
-{
-	return new CodeGenEnv();
-}
-
-bool CodeGenUnit::preGenerateCode(FileParsingResult const& parsingResult, CodeGenEnv& env) noexcept
-{
-	//Setup generation environment
-	env._fileParsingResult	= &parsingResult;
-	env._logger				= logger;
-
-	return true;
-}
-
-bool CodeGenUnit::postGenerateCode(CodeGenEnv& /* env */) noexcept
-{
-	//Default implementation does nothing
-	return true;
-}
-ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPair(std::function<ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*)> visitor, CodeGenEnv& env) noexcept
-{
-	assert(visitor != nullptr);
-
-	ETraversalBehaviour result;
-
-	//Call visitor on all code generators
-	for (ICodeGenerator* codeGenerator : getSortedCodeGenerators())
+	for (CodeGenModule* codeGenModule : _generationModules)
 	{
-		for (NamespaceInfo const& namespace_ : env.getFileParsingResult()->namespaces)
-		{
-			result = foreachCodeGenEntityPairInNamespace(*codeGenerator, namespace_, env, visitor);
-
-			HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-		}
-
-		for (StructClassInfo const& struct_ : env.getFileParsingResult()->structs)
-		{
-			result = foreachCodeGenEntityPairInStruct(*codeGenerator, struct_, env, visitor);
-
-			HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-		}
-
-		for (StructClassInfo const& class_ : env.getFileParsingResult()->classes)
-		{
-			result = foreachCodeGenEntityPairInStruct(*codeGenerator, class_, env, visitor);
-
-			HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-		}
-
-		for (EnumInfo const& enum_ : env.getFileParsingResult()->enums)
-		{
-			result = foreachCodeGenEntityPairInEnum(*codeGenerator, enum_, env, visitor);
-
-			HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-		}
-
-		for (VariableInfo const& variable : env.getFileParsingResult()->variables)
-		{
-			result = codeGenerator->callVisitorOnEntity(variable, env, visitor);
-
-			HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-		}
-
-		for (FunctionInfo const& function : env.getFileParsingResult()->functions)
+		for (PropertyCodeGen* propertyCodeGen : codeGenModule->getPropertyCodeGenerators())
 		{
-			result = codeGenerator->callVisitorOnEntity(function, env, visitor);
+			uint32 index = static_cast<uint32>(std::find(_sortedCodeGenerators.cbegin(), _sortedCodeGenerators.cend(), propertyCodeGen) - _sortedCodeGenerators.cbegin());
 
-			HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
+			_propertyCodeGeneratorsPerName[propertyCodeGen->getPropertyName()].push_back(index);
+			isBoundToProperty[index] = true;
 		}
 	}
 
-	return ETraversalBehaviour::Recurse;
-}
-
-ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPairInNamespace(ICodeGenerator& codeGenerator, NamespaceInfo const& namespace_, CodeGenEnv& env,
-																	 std::function<ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*)> visitor) noexcept
-{
-	assert(visitor != nullptr);
-
-	//Execute the visitor function on the current namespace
-	ETraversalBehaviour result = codeGenerator.callVisitorOnEntity(namespace_, env, visitor);
-
-	if (result != ETraversalBehaviour::Recurse)
-	{
-		return result;
-	}
-
-	//Iterate and execute the provided visitor function recursively on all nested entities
-	for (NamespaceInfo const& nestedNamespace : namespace_.namespaces)
-	{
-		result = foreachCodeGenEntityPairInNamespace(codeGenerator, nestedNamespace, env, visitor);
-
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-	}
-
-	for (StructClassInfo const& struct_ : namespace_.structs)
-	{
-		result = foreachCodeGenEntityPairInStruct(codeGenerator, struct_, env, visitor);
-
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-	}
-
-	for (StructClassInfo const& class_ : namespace_.classes)
+	//Keep indices sorted by generation order
+	for (auto& [propertyName, codeGenerators] : _propertyCodeGeneratorsPerName)
 	{
-		result = foreachCodeGenEntityPairInStruct(codeGenerator, class_, env, visitor);
-
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
+		std::sort(codeGenerators.begin(), codeGenerators.end());
 	}
 
-	for (EnumInfo const& enum_ : namespace_.enums)
+	//Bucket all other generators by eligible entity type
+	for (uint32 i = 0u; i < _sortedCodeGenerators.size(); i++)
 	{
-		result = foreachCodeGenEntityPairInEnum(codeGenerator, enum_, env, visitor);
+		EEntityType eligibleEntityMask = _sortedCodeGenerators[i]->getEligibleEntityMask();
 
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-	}
-
-	for (VariableInfo const& variable : namespace_.variables)
-	{
-		result = codeGenerator.callVisitorOnEntity(variable, env, visitor);
-
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-	}
+		_eligibleEntityMasks.push_back(eligibleEntityMask);
 
-	for (FunctionInfo const& function : namespace_.functions)
-	{
-		result = codeGenerator.callVisitorOnEntity(function, env, visitor);
-
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
+		if (!isBoundToProperty[i])
+		{
+			for (size_t typeIndex = 0u; typeIndex < entityTypesCount; typeIndex++)
+			{
+				if (eligibleEntityMask && static_cast<EEntityType>(1 << typeIndex))
+				{
+					_unboundCodeGeneratorsPerEntityType[typeIndex].push_back(i);
+				}
+			}
+		}
 	}
-
-	return ETraversalBehaviour::Recurse;
 }
 
-ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPairInStruct(ICodeGenerator& codeGenerator, StructClassInfo const& struct_, CodeGenEnv& env,
-																  std::function<ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*)> visitor) noexcept
+std::vector<uint32> const& CodeGenUnit::getEligibleCodeGenerators(EntityInfo const& entity) noexcept
 {
-	assert(visitor != nullptr);
+	std::vector<uint32> const& unboundCodeGenerators = _unboundCodeGeneratorsPerEntityType[getEntityTypeIndex(entity.entityType)];
 
-	//Execute the visitor function on the current struct/class
-	ETraversalBehaviour result = codeGenerator.callVisitorOnEntity(struct_, env, visitor);
-
-	if (result != ETraversalBehaviour::Recurse)
+	if (entity.properties.empty() || _propertyCodeGeneratorsPerName.empty())
 	{
-		return result;
+		return unboundCodeGenerators;
 	}
 
-	//Iterate and execute the provided visitor function recursively on all nested entities
-	for (std::shared_ptr<NestedStructClassInfo> const& nestedStruct : struct_.nestedStructs)
-	{
-		result = foreachCodeGenEntityPairInStruct(codeGenerator, *nestedStruct, env, visitor);
+	_eligibleCodeGenerators = unboundCodeGenerators;
 
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-	}
-
-	for (std::shared_ptr<NestedStructClassInfo> const& nestedClass : struct_.nestedClasses)
-	{
-		result = foreachCodeGenEntityPairInStruct(codeGenerator, *nestedClass, env, visitor);
-
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-	}
-
-	for (NestedEnumInfo const& nestedEnum : struct_.nestedEnums)
+	for (Property const& property : entity.properties)
 	{
-		result = foreachCodeGenEntityPairInEnum(codeGenerator, nestedEnum, env, visitor);
+		auto it = _propertyCodeGeneratorsPerName.find(property.name);
 
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
+		if (it != _propertyCodeGeneratorsPerName.cend())
+		{
+			for (uint32 index : it->second)
+			{
+				if (_eligibleEntityMasks[index] && entity.entityType)
+				{
+					_eligibleCodeGenerators.push_back(index);
+				}
+			}
+		}
 	}
 
-	for (FieldInfo const& field : struct_.fields)
-	{
-		result = codeGenerator.callVisitorOnEntity(field, env, visitor);
-
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-	}
+	//A PropertyCodeGen iterates over all the entity properties itself, so must be called only once per entity
+	std::sort(_eligibleCodeGenerators.begin(), _eligibleCodeGenerators.end());
+	_eligibleCodeGenerators.erase(std::unique(_eligibleCodeGenerators.begin(), _eligibleCodeGenerators.end()), _eligibleCodeGenerators.end());
 
-	for (MethodInfo const& method : struct_.methods)
-	{
-		result = codeGenerator.callVisitorOnEntity(method, env, visitor);
+	return _eligibleCodeGenerators;
+}
 
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-	}
-	
-	return ETraversalBehaviour::Recurse;
+CodeGenEnv* CodeGenUnit::createCodeGenEnv() const noexcept
+{
+	return new CodeGenEnv();
 }
 
-ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPairInEnum(ICodeGenerator& codeGenerator, EnumInfo const& enum_, CodeGenEnv& env,
-																std::function<ETraversalBehaviour(ICodeGenerator&, EntityInfo const&, CodeGenEnv&, void const*)> visitor) noexcept
+bool CodeGenUnit::preGenerateCode(FileParsingResult const& parsingResult, CodeGenEnv& env) noexcept
 {
-	assert(visitor != nullptr);
+	//Setup generation environment
+	env._fileParsingResult	= &parsingResult;
+	env._logger				= logger;
 
-	//Execute the visitor function on the current enum
-	ETraversalBehaviour result = codeGenerator.callVisitorOnEntity(enum_, env, visitor);
+	return true;
+}
 
-	if (result != ETraversalBehaviour::Recurse)
+bool CodeGenUnit::postGenerateCode(CodeGenEnv& /* env */) noexcept
+{
+	//Default implementation does nothing
+	return true;
+}
+bool CodeGenUnit::isAnyCodeGeneratorEligible(std::vector<uint8> const& activeCodeGenerators, EEntityType entityTypes) const noexcept
+{
+	for (size_t i = 0u; i < activeCodeGenerators.size(); i++)
 	{
-		return result;
+		if (activeCodeGenerators[i] != 0u && _codeGeneratorAbortResults[i] == ETraversalBehaviour::Recurse && (_eligibleEntityMasks[i] && entityTypes))
+		{
+			return true;
+		}
 	}
 
-	//Iterate and execute the provided visitor function recursively on all enum values
-	for (EnumValueInfo const& enumValue : enum_.enumValues)
-	{
-		result = codeGenerator.callVisitorOnEntity(enumValue, env, visitor);
-
-		HANDLE_NESTED_ENTITY_ITERATION_RESULT(result);
-	}
-	
-	return ETraversalBehaviour::Recurse;
+	return false;
 }
 
 void CodeGenUnit::clearGenerationModules() noexcept
@@ -448,12 +303,15 @@ void CodeGenUnit::clearGenerationModules() noexcept
 	}
 
 	_generationModules.clear();
+
+	refreshCodeGenerators();
 }
 
 void CodeGenUnit::addModule(CodeGenModule& generationModule) noexcept
 {
-	//Add modules sorted by generation order
 	_generationModules.emplace_back(&generationModule);
+
+	refreshCodeGenerators();
 }
 
 bool CodeGenUnit::removeModule(CodeGenModule const& generationModule) noexcept
@@ -464,6 +322,8 @@ bool CodeGenUnit::removeModule(CodeGenModule const& generationModule) noexcept
 	{
 		_generationModules.erase(it);
 
+		refreshCodeGenerators();
+
 		return true;
 	}
 
@@ -493,6 +353,18 @@ uint8 CodeGenUnit::getIterationCount() const noexcept
 	}
 }
 
+EParsedData CodeGenUnit::getRequiredParsedData() const noexcept
+{
+	EParsedData result = EParsedData::None;
+
+	for (CodeGenModule const* codeGenModule : _generationModules)
+	{
+		result = result | codeGenModule->getRequiredParsedData();
+	}
+
+	return result;
+}
+
 std::vector<CodeGenModule*>	const& CodeGenUnit::getRegisteredCodeGenModules() const noexcept
 {
 	return _generationModules;
@@ -520,8 +392,10 @@ CodeGenUnit& CodeGenUnit::operator=(CodeGenUnit const& other) noexcept
 	//each CodeGenUnit instance owns their own modules
 	for (size_t i = 0; i < other._generationModules.size(); i++)
 	{
-		addModule(*static_cast<CodeGenModule*>(other._generationModules[i]->clone()));
+		_generationModules.emplace_back(static_cast<CodeGenModule*>(other._generationModules[i]->clone()));
 	}
 
+	refreshCodeGenerators();
+
 	return *this;
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "Kodgen/CodeGen/CodeWriter.h"
+
+#include <cassert>
+
+using namespace kodgen;
+
+CodeWriter::FormatArg::FormatArg(std::string_view string) noexcept:
+	_view{string}
+{
+}
+
+CodeWriter::FormatArg::FormatArg(std::string const& string) noexcept:
+	_view{string}
+{
+}
+
+CodeWriter::FormatArg::FormatArg(char const* string) noexcept:
+	_view{string}
+{
+}
+
+CodeWriter::FormatArg::FormatArg(InternedString const& string) noexcept:
+	_view{string.str()}
+{
+}
+
+CodeWriter::FormatArg::FormatArg(char character) noexcept
+{
+	_buffer[0] = character;
+	_view = std::string_view(_buffer, 1u);
+}
+
+CodeWriter::CodeWriter(std::string& output, std::string_view separator, size_t capacityHint) noexcept:
+	_output{output},
+	_separator{separator}
+{
+	reserve(capacityHint);
+}
+
+CodeWriter& CodeWriter::reserve(size_t additionalSize) noexcept
+{
+	size_t requiredCapacity = _output.size() + additionalSize;
+
+	if (requiredCapacity > _output.capacity())
+	{
+		_output.reserve((requiredCapacity > _output.capacity() * 2u) ? requiredCapacity : _output.capacity() * 2u);
+	}
+
+	return *this;
+}
+
+void CodeWriter::writeFormatted(std::string_view format, FormatArg const* args, size_t argsCount) noexcept
+{
+	//Reserve the whole formatted string at once
+	size_t formattedSize = format.size();
+
+	for (size_t i = 0u; i < argsCount; i++)
+	{
+		formattedSize += args[i].getView().size();
+	}
+
+	reserve(formattedSize);
+
+	size_t argIndex	= 0u;
+	size_t start	= 0u;
+
+	for (size_t placeholder = format.find("{}"); placeholder != std::string_view::npos; placeholder = format.find("{}", start))
+	{
+		//If you assert here, the format string contains more {} than provided arguments
+		assert(argIndex < argsCount);
+
+		//Without assertions, the placeholders left without argument are written as is
+		if (argIndex == argsCount)
+		{
+			break;
+		}
+
+		_output.append(format.data() + start, placeholder - start);
+		_output.append(args[argIndex++].getView());
+
+		start = placeholder + 2u;
+	}
+
+	//If you assert here, the format string contains less {} than provided arguments
+	assert(argIndex == argsCount);
+
+	_output.append(format.data() + start, format.size() - start);
+}
+
+CodeWriter& CodeWriter::endLine() noexcept
+{
+	_output.append(_separator);
+
+	return *this;
+}
+
+CodeWriter& CodeWriter::indent() noexcept
+{
+	_indentLevel++;
+
+	return *this;
+}
+
+CodeWriter& CodeWriter::unindent() noexcept
+{
+	assert(_indentLevel > 0u);
+
+	_indentLevel--;
+
+	return *this;
+}
\ No newline at end of file
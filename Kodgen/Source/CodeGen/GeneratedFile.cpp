@@ -1,27 +1,46 @@
 #include "Kodgen/CodeGen/GeneratedFile.h"
 
+#include <fstream>
+
 using namespace kodgen;
 
-GeneratedFile::GeneratedFile(fs::path&& generatedFilePath, fs::path const& sourceFilePath) noexcept :
+GeneratedFile::GeneratedFile(fs::path&& generatedFilePath, fs::path const& sourceFilePath, bool onlyWriteIfChanged) noexcept :
 	_path{ std::forward<fs::path>(generatedFilePath) },
-	_sourceFilePath{ sourceFilePath }
+	_sourceFilePath{ sourceFilePath },
+	_onlyWriteIfChanged{ onlyWriteIfChanged }
 {
-	_streamToFile = std::ofstream(_path.string(), std::ios::out | std::ios::trunc);
 }
 
 GeneratedFile::~GeneratedFile() noexcept
 {
-	_streamToFile.close();
+	std::string content = _content.str();
+
+	if (_onlyWriteIfChanged && fs::exists(_path))
+	{
+		std::ifstream		existingFile(_path.string(), std::ios::in | std::ios::binary);
+		std::ostringstream	existingContent;
+
+		existingContent << existingFile.rdbuf();
+
+		//Don't touch the file so that whatever depends on it isn't rebuilt
+		//Both files are accessed in binary mode so that newline translation can't make them differ
+		if (existingContent.str() == content)
+		{
+			return;
+		}
+	}
+
+	std::ofstream(_path.string(), std::ios::out | std::ios::trunc | std::ios::binary) << content;
 }
 
 void GeneratedFile::writeLine(std::string const& line) noexcept
 {
-	_streamToFile << line << "\n";
+	_content << line << "\n";
 }
 
 void GeneratedFile::writeLine(std::string&& line) noexcept
 {
-	_streamToFile << std::forward<std::string>(line) << "\n";
+	_content << std::forward<std::string>(line) << "\n";
 }
 
 void GeneratedFile::writeLines(std::string const& line) noexcept
@@ -1,5 +1,12 @@
 #include "Kodgen/CodeGen/ICodeGenerator.h"
 
+#include <typeinfo>
+#include <cstdlib>	//std::free
+
+#if defined(__GNUC__) || defined(__clang__)
+#include <cxxabi.h>
+#endif
+
 using namespace kodgen;
 
 int32 ICodeGenerator::getGenerationOrder() const noexcept
@@ -10,4 +17,29 @@ int32 ICodeGenerator::getGenerationOrder() const noexcept
 uint8 ICodeGenerator::getIterationCount() const noexcept
 {
 	return 1u;
+}
+
+EEntityType ICodeGenerator::getEligibleEntityMask() const noexcept
+{
+	return allEntityTypes;
+}
+
+std::string ICodeGenerator::getName() const noexcept
+{
+	char const* typeName = typeid(*this).name();
+
+#if defined(__GNUC__) || defined(__clang__)
+	int		status			= 0;
+	char*	demangledName	= abi::__cxa_demangle(typeName, nullptr, nullptr, &status);
+
+	if (status == 0 && demangledName != nullptr)
+	{
+		std::string result(demangledName);
+		std::free(demangledName);
+
+		return result;
+	}
+#endif
+
+	return typeName;
 }
\ No newline at end of file
@@ -0,0 +1,18 @@
+#include "Kodgen/CodeGen/Macro/MacroCodeEmitter.h"
+
+#include <cassert>
+
+#include "Kodgen/CodeGen/Macro/MacroCodeGenEnv.h"
+
+using namespace kodgen;
+
+std::string& MacroCodeEmitter::selectLocation(MacroCodeGenEnv& env, ECodeGenLocation location) const noexcept
+{
+	assert(hasSink(location));
+	assert(_separators != nullptr);
+
+	env._codeGenLocation	= location;
+	env._separator			= (*_separators)[static_cast<size_t>(location)];
+
+	return *_sinks[static_cast<size_t>(location)];
+}
\ No newline at end of file
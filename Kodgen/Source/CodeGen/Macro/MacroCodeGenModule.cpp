@@ -1,9 +1,12 @@
 #include "Kodgen/CodeGen/Macro/MacroCodeGenModule.h"
 
+#include <cassert>
+
 #include "Kodgen/Config.h"
 #include "Kodgen/InfoStructures/EntityInfo.h"
 #include "Kodgen/CodeGen/CodeGenHelpers.h"
 #include "Kodgen/CodeGen/Macro/MacroCodeGenEnv.h"
+#include "Kodgen/CodeGen/Macro/MacroCodeEmitter.h"
 #include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
 
 using namespace kodgen;
@@ -16,46 +19,43 @@ uint8 MacroCodeGenModule::getIterationCount() const noexcept
 	return (highestPropertyCodeGenItCount > 2u) ? highestPropertyCodeGenItCount : 2u;
 }
 
-ETraversalBehaviour MacroCodeGenModule::generateCodeForEntity(EntityInfo const& entity, CodeGenEnv& env, std::string& inout_result) noexcept
+ETraversalBehaviour MacroCodeGenModule::generateCodeForEntity(EntityInfo const& entity, CodeGenEnv& env, std::string& /* inout_result */) noexcept
 {
-	MacroCodeGenEnv& macroEnv = static_cast<MacroCodeGenEnv&>(env);
+	MacroCodeGenEnv&	macroEnv	= static_cast<MacroCodeGenEnv&>(env);
+	MacroCodeEmitter*	emitter		= macroEnv.getEmitter();
+
+	//If you assert here, the module is used outside of MacroCodeGenUnit::generateCodeForEntity
+	assert(emitter != nullptr);
+
+	if (!preGenerateCodeForEntity(entity, macroEnv))
+	{
+		return ETraversalBehaviour::AbortWithFailure;
+	}
+
+	ETraversalBehaviour result = CodeGenHelpers::leastPrioritizedTraversalBehaviour;
 
-	ETraversalBehaviour result;
+	//Generate the code of all locations the module emits to in a single pass
+	if (emitter->hasSink(ECodeGenLocation::HeaderFileHeader))
+	{
+		result = CodeGenHelpers::combineTraversalBehaviours(result, generateHeaderFileHeaderCodeForEntity(entity, macroEnv, emitter->selectLocation(macroEnv, ECodeGenLocation::HeaderFileHeader)));
+	}
 
-	//Dispatch code generation call to the right sub-method
-	switch (macroEnv.getCodeGenLocation())
+	if (emitter->hasSink(ECodeGenLocation::ClassFooter))
 	{
-		case ECodeGenLocation::HeaderFileHeader:
-			if (preGenerateCodeForEntity(entity, macroEnv))
-			{
-				return generateHeaderFileHeaderCodeForEntity(entity, macroEnv, inout_result);
-			}
-			else
-			{
-				return ETraversalBehaviour::AbortWithFailure;
-			}
-
-		case ECodeGenLocation::ClassFooter:
-			return generateClassFooterCodeForEntity(entity, macroEnv, inout_result);
-
-		case ECodeGenLocation::HeaderFileFooter:
-			return generateHeaderFileFooterCodeForEntity(entity, macroEnv, inout_result);
-
-		case ECodeGenLocation::SourceFileHeader:
-			result = generateSourceFileHeaderCodeForEntity(entity, macroEnv, inout_result);
-
-			return (postGenerateCodeForEntity(entity, macroEnv)) ? result : ETraversalBehaviour::AbortWithFailure;
-
-		case ECodeGenLocation::Count:
-			[[fallthrough]];
-		default:
-			//Should never get here
-			if (env.getLogger() != nullptr)
-			{
-				env.getLogger()->log("MacroPropertyCodeGen::generateCode called with unhandled ECodeGenLocation. Abort generation.", ILogger::ELogSeverity::Error);
-			}
-			return ETraversalBehaviour::AbortWithFailure;
+		result = CodeGenHelpers::combineTraversalBehaviours(result, generateClassFooterCodeForEntity(entity, macroEnv, emitter->selectLocation(macroEnv, ECodeGenLocation::ClassFooter)));
 	}
+
+	if (emitter->hasSink(ECodeGenLocation::HeaderFileFooter))
+	{
+		result = CodeGenHelpers::combineTraversalBehaviours(result, generateHeaderFileFooterCodeForEntity(entity, macroEnv, emitter->selectLocation(macroEnv, ECodeGenLocation::HeaderFileFooter)));
+	}
+
+	if (emitter->hasSink(ECodeGenLocation::SourceFileHeader))
+	{
+		result = CodeGenHelpers::combineTraversalBehaviours(result, generateSourceFileHeaderCodeForEntity(entity, macroEnv, emitter->selectLocation(macroEnv, ECodeGenLocation::SourceFileHeader)));
+	}
+
+	return (postGenerateCodeForEntity(entity, macroEnv)) ? result : ETraversalBehaviour::AbortWithFailure;
 }
 
 bool MacroCodeGenModule::initialGenerateCode(CodeGenEnv& env, std::string& inout_result) noexcept
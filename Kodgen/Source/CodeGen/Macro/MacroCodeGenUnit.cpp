@@ -1,10 +1,13 @@
 #include "Kodgen/CodeGen/Macro/MacroCodeGenUnit.h"
 
+#include <algorithm>
+
 #include "Kodgen/Config.h"
 #include "Kodgen/CodeGen/GeneratedFile.h"
 #include "Kodgen/CodeGen/CodeGenHelpers.h"
 #include "Kodgen/CodeGen/Macro/MacroCodeGenUnitSettings.h"
 #include "Kodgen/CodeGen/Macro/MacroCodeGenModule.h"
+#include "Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h"
 
 using namespace kodgen;
 
@@ -21,7 +24,8 @@ MacroCodeGenEnv* MacroCodeGenUnit::createCodeGenEnv() const noexcept
 	return new MacroCodeGenEnv();
 }
 
-void MacroCodeGenUnit::initialGenerateCode(CodeGenEnv& env, std::function<void(CodeGenEnv&, std::string&)> generate) noexcept
+void MacroCodeGenUnit::generateFileCode(CodeGenEnv& env, std::function<void(CodeGenEnv&, std::string&)> generate,
+										std::array<std::string, static_cast<size_t>(ECodeGenLocation::Count)>& inout_codePerLocation) noexcept
 {
 	MacroCodeGenEnv& macroEnv = static_cast<MacroCodeGenEnv&>(env);
 
@@ -32,7 +36,7 @@ void MacroCodeGenUnit::initialGenerateCode(CodeGenEnv& env, std::function<void(C
 		macroEnv._separator = _separators[i];
 
 		/**
-		*	No initial call when the CodeGenLocation is ClassFooter
+		*	No initial/final call when the CodeGenLocation is ClassFooter
 		*/
 		if (macroEnv._codeGenLocation == ECodeGenLocation::ClassFooter)
 		{
@@ -40,48 +44,30 @@ void MacroCodeGenUnit::initialGenerateCode(CodeGenEnv& env, std::function<void(C
 		}
 		else
 		{
-			generate(macroEnv, _generatedCodePerLocation[i]);
+			generate(macroEnv, inout_codePerLocation[i]);
 		}
 	}
 }
 
+void MacroCodeGenUnit::initialGenerateCode(CodeGenEnv& env, std::function<void(CodeGenEnv&, std::string&)> generate) noexcept
+{
+	generateFileCode(env, generate, _generatedCodePerLocation);
+}
+
 void MacroCodeGenUnit::finalGenerateCode(CodeGenEnv& env, std::function<void(CodeGenEnv&, std::string&)> generate) noexcept
 {
-	//Exactly same flow as initialGenerateCode
-	initialGenerateCode(env, generate);
+	//Same flow as initialGenerateCode, but the final code is appended after the entity code in postGenerateCode
+	generateFileCode(env, generate, _finalGeneratedCodePerLocation);
 }
 
 void MacroCodeGenUnit::generateCodeForEntity(EntityInfo const& entity, CodeGenEnv& env, std::function<void(EntityInfo const&, CodeGenEnv&, std::string&)> generate)	noexcept
 {
-	MacroCodeGenEnv& macroEnv = static_cast<MacroCodeGenEnv&>(env);
-
-	//Generate code for each code location
-	for (int i = 0u; i < static_cast<int>(ECodeGenLocation::Count); i++)
-	{
-		macroEnv._codeGenLocation = static_cast<ECodeGenLocation>(i);
-		macroEnv._separator = _separators[i];
+	generateCodeForEntityInternal(entity, env, generate);
+}
 
-		/**
-		*	Forward ECodeGenLocation::ClassFooter generation only if the entity is a
-		*	struct, class, method or field
-		*/
-		if (macroEnv._codeGenLocation == ECodeGenLocation::ClassFooter)
-		{
-			if (!(entity.entityType == EEntityType::Struct || entity.entityType == EEntityType::Class ||
-				entity.entityType == EEntityType::Method || entity.entityType == EEntityType::Field))
-			{
-				continue;
-			}
-			else
-			{
-				generateEntityClassFooterCode(entity, macroEnv, generate);
-			}
-		}
-		else
-		{
-			generate(entity, macroEnv, _generatedCodePerLocation[i]);
-		}
-	}
+bool MacroCodeGenUnit::generateCode(FileParsingResult const& parsingResult, FileTimings* out_timings) noexcept
+{
+	return generateCodeInternal<MacroCodeGenUnit>(parsingResult, out_timings);
 }
 
 bool MacroCodeGenUnit::preGenerateCode(FileParsingResult const& parsingResult, CodeGenEnv& env) noexcept
@@ -100,6 +86,40 @@ bool MacroCodeGenUnit::preGenerateCode(FileParsingResult const& parsingResult, C
 			generatedCode.clear();
 		}
 
+		for (std::string& generatedCode : _finalGeneratedCodePerLocation)
+		{
+			generatedCode.clear();
+		}
+
+		_entityGeneratedCodePerLocation.resize(getSortedCodeGenerators().size());
+
+		//Cache the code locations each code generator emits entity code to
+		std::vector<ICodeGenerator*> const& codeGenerators = getSortedCodeGenerators();
+
+		_entityCodeLocations.resize(codeGenerators.size());
+
+		for (CodeGenModule* codeGenModule : getRegisteredCodeGenModules())
+		{
+			auto it = std::find(codeGenerators.cbegin(), codeGenerators.cend(), codeGenModule);
+			_entityCodeLocations[it - codeGenerators.cbegin()] = static_cast<MacroCodeGenModule*>(codeGenModule)->getEntityCodeLocations();
+
+			for (PropertyCodeGen* propertyCodeGen : codeGenModule->getPropertyCodeGenerators())
+			{
+				it = std::find(codeGenerators.cbegin(), codeGenerators.cend(), propertyCodeGen);
+				_entityCodeLocations[it - codeGenerators.cbegin()] = static_cast<MacroPropertyCodeGen*>(propertyCodeGen)->getEntityCodeLocations();
+			}
+		}
+
+		_emitter._separators = &_separators;
+
+		for (auto& codePerLocation : _entityGeneratedCodePerLocation)
+		{
+			for (std::string& generatedCode : codePerLocation)
+			{
+				generatedCode.clear();
+			}
+		}
+
 		return true;
 	}
 
@@ -108,6 +128,8 @@ bool MacroCodeGenUnit::preGenerateCode(FileParsingResult const& parsingResult, C
 
 bool MacroCodeGenUnit::postGenerateCode(CodeGenEnv& env) noexcept
 {
+	mergeGeneratedCode();
+
 	//Create generated header & generated source files
 	generateHeaderFile(static_cast<MacroCodeGenEnv&>(env));
 	generateSourceFile(static_cast<MacroCodeGenEnv&>(env));
@@ -145,9 +167,19 @@ void MacroCodeGenUnit::generateHeaderFile(MacroCodeGenEnv& env) noexcept
 
 			if (!struct_->isForwardDeclaration)
 			{
-				auto it = _classFooterGeneratedCode.find(struct_);
+				auto		it				= _classFooterGeneratedCode.find(struct_);
+				std::string	classFooterCode;
 
-				generatedHeader.writeMacro(castSettings->getClassFooterMacro(*struct_), (it != _classFooterGeneratedCode.end()) ? std::move(it->second) : std::string());
+				if (it != _classFooterGeneratedCode.end())
+				{
+					//Concatenate the code of each code generator in generation order
+					for (std::string& generatedCode : it->second)
+					{
+						classFooterCode += generatedCode;
+					}
+				}
+
+				generatedHeader.writeMacro(castSettings->getClassFooterMacro(*struct_), std::move(classFooterCode));
 
 				auto codeGenIdentifierLine = struct_->codeGenIdentifierLine;
 				if (codeGenIdentifierLine > 0)
@@ -193,12 +225,12 @@ bool MacroCodeGenUnit::isUpToDate(fs::path const& sourceFile) const noexcept
 	return false;
 }
 
-void MacroCodeGenUnit::generateEntityClassFooterCode(EntityInfo const& entity, CodeGenEnv& env, std::function<void(EntityInfo const&, CodeGenEnv&, std::string&)> generate) noexcept
+std::string& MacroCodeGenUnit::getEntityClassFooterGeneratedCode(EntityInfo const& entity, uint32 codeGeneratorIndex) noexcept
 {
 	if (entity.entityType == EEntityType::Struct || entity.entityType == EEntityType::Class)
 	{
 		//If the entity is a struct/class, append to the footer of the struct/class
-		generate(entity, env, _classFooterGeneratedCode[&reinterpret_cast<StructClassInfo const&>(entity)]);
+		return getClassFooterGeneratedCode(&reinterpret_cast<StructClassInfo const&>(entity), codeGeneratorIndex);
 	}
 	else
 	{
@@ -206,7 +238,32 @@ void MacroCodeGenUnit::generateEntityClassFooterCode(EntityInfo const& entity, C
 		assert(entity.outerEntity->entityType == EEntityType::Struct || entity.outerEntity->entityType == EEntityType::Class);
 
 		//If the entity is NOT a struct/class, append to the footer of the outer struct/class
-		generate(entity, env, _classFooterGeneratedCode[reinterpret_cast<StructClassInfo const*>(entity.outerEntity)]);
+		return getClassFooterGeneratedCode(reinterpret_cast<StructClassInfo const*>(entity.outerEntity), codeGeneratorIndex);
+	}
+}
+
+std::string& MacroCodeGenUnit::getClassFooterGeneratedCode(StructClassInfo const* struct_, uint32 codeGeneratorIndex) noexcept
+{
+	std::vector<std::string>& codePerCodeGenerator = _classFooterGeneratedCode[struct_];
+
+	if (codePerCodeGenerator.size() <= codeGeneratorIndex)
+	{
+		codePerCodeGenerator.resize(codeGeneratorIndex + 1u);
+	}
+
+	return codePerCodeGenerator[codeGeneratorIndex];
+}
+
+void MacroCodeGenUnit::mergeGeneratedCode() noexcept
+{
+	for (size_t i = 0u; i < static_cast<size_t>(ECodeGenLocation::Count); i++)
+	{
+		for (auto& codePerLocation : _entityGeneratedCodePerLocation)
+		{
+			_generatedCodePerLocation[i] += codePerLocation[i];
+		}
+
+		_generatedCodePerLocation[i] += _finalGeneratedCodePerLocation[i];
 	}
 }
 
@@ -109,4 +109,9 @@ bool MacroCodeGenerator::finalGenerateSourceFileHeaderCode(MacroCodeGenEnv& /* e
 {
 	//Default implementation generates no code
 	return true;
+}
+
+ECodeGenLocationMask MacroCodeGenerator::getEntityCodeLocations() const noexcept
+{
+	return ECodeGenLocationMask::All;
 }
\ No newline at end of file
@@ -2,39 +2,47 @@
 
 #include <cassert>
 
+#include "Kodgen/CodeGen/Macro/MacroCodeEmitter.h"
+
 using namespace kodgen;
 
-bool MacroPropertyCodeGen::generateCodeForEntity(EntityInfo const& entity, Property const& property, uint8 propertyIndex, CodeGenEnv& env, std::string& inout_result) noexcept
+bool MacroPropertyCodeGen::generateCodeForEntity(EntityInfo const& entity, Property const& property, uint8 propertyIndex, CodeGenEnv& env, std::string& /* inout_result */) noexcept
 {
-	MacroCodeGenEnv& macroData = static_cast<MacroCodeGenEnv&>(env);
+	MacroCodeGenEnv&	macroEnv	= static_cast<MacroCodeGenEnv&>(env);
+	MacroCodeEmitter*	emitter		= macroEnv.getEmitter();
+
+	//If you assert here, the property code generator is used outside of MacroCodeGenUnit::generateCodeForEntity
+	assert(emitter != nullptr);
+
+	if (!preGenerateCodeForEntity(entity, property, propertyIndex, macroEnv))
+	{
+		return false;
+	}
+
+	bool result = true;
+
+	//Generate the code of all locations the property code generator emits to in a single pass
+	if (emitter->hasSink(ECodeGenLocation::HeaderFileHeader))
+	{
+		result &= generateHeaderFileHeaderCodeForEntity(entity, property, propertyIndex, macroEnv, emitter->selectLocation(macroEnv, ECodeGenLocation::HeaderFileHeader));
+	}
+
+	if (emitter->hasSink(ECodeGenLocation::ClassFooter))
+	{
+		result &= generateClassFooterCodeForEntity(entity, property, propertyIndex, macroEnv, emitter->selectLocation(macroEnv, ECodeGenLocation::ClassFooter));
+	}
 
-	//Dispatch code generation call to the right sub-method
-	switch (macroData.getCodeGenLocation())
+	if (emitter->hasSink(ECodeGenLocation::HeaderFileFooter))
 	{
-		case ECodeGenLocation::HeaderFileHeader:
-			return	preGenerateCodeForEntity(entity, property, propertyIndex, macroData) &&
-					generateHeaderFileHeaderCodeForEntity(entity, property, propertyIndex, macroData, inout_result);
-
-		case ECodeGenLocation::ClassFooter:
-			return generateClassFooterCodeForEntity(entity, property, propertyIndex, macroData, inout_result);
-
-		case ECodeGenLocation::HeaderFileFooter:
-			return generateHeaderFileFooterCodeForEntity(entity, property, propertyIndex, macroData, inout_result);
-
-		case ECodeGenLocation::SourceFileHeader:
-			return	generateSourceFileHeaderCodeForEntity(entity, property, propertyIndex, macroData, inout_result) &&
-					postGenerateCodeForEntity(entity, property, propertyIndex, macroData);
-
-		case ECodeGenLocation::Count:
-			[[fallthrough]];
-		default:
-			//Should never get here
-			if (env.getLogger() != nullptr)
-			{
-				env.getLogger()->log("MacroPropertyCodeGen::generateCode called with unhandled ECodeGenLocation. Abort generation.", ILogger::ELogSeverity::Error);
-			}
-			return false;
+		result &= generateHeaderFileFooterCodeForEntity(entity, property, propertyIndex, macroEnv, emitter->selectLocation(macroEnv, ECodeGenLocation::HeaderFileFooter));
 	}
+
+	if (emitter->hasSink(ECodeGenLocation::SourceFileHeader))
+	{
+		result &= generateSourceFileHeaderCodeForEntity(entity, property, propertyIndex, macroEnv, emitter->selectLocation(macroEnv, ECodeGenLocation::SourceFileHeader));
+	}
+
+	return result && postGenerateCodeForEntity(entity, property, propertyIndex, macroEnv);
 }
 
 bool MacroPropertyCodeGen::initialGenerateCode(CodeGenEnv& env, std::string& inout_result) noexcept
@@ -49,26 +49,5 @@ ETraversalBehaviour PropertyCodeGen::callVisitorOnEntity(EntityInfo const& entit
 {
 	assert(visitor != nullptr);
 
-	//Call the visitor if the entity type is contained in the _eligibleEntities mask
-	if (_eligibleEntityMask && entity.entityType)
-	{
-		AdditionalData data;
-
-		//Execute the visitor on each property contained in the entity
-		for (uint8 i = 0; i < entity.properties.size(); i++)
-		{
-			data.propertyIndex = i;
-			data.property = &entity.properties[i];
-
-			if (shouldGenerateCodeForEntity(entity, *data.property, data.propertyIndex))
-			{
-				if (visitor(*this, entity, env, &data) == ETraversalBehaviour::AbortWithFailure)
-				{
-					return ETraversalBehaviour::AbortWithFailure;
-				}
-			}
-		}
-	}
-
-	return shouldIterateOnNestedEntities(entity) ? ETraversalBehaviour::Recurse : ETraversalBehaviour::Continue;
+	return visitEntity(entity, env, visitor);
 }
\ No newline at end of file
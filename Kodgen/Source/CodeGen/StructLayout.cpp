@@ -0,0 +1,179 @@
+#include "Kodgen/CodeGen/StructLayout.h"
+
+#include <algorithm>	//std::stable_sort, std::count_if, std::max
+
+using namespace kodgen;
+
+bool StructLayout::compute(StructClassInfo const& structClass, fs::path const& declaringFile, StructLayout& out_layout) noexcept
+{
+	//Size is unknown for incomplete and dependent types
+	if (structClass.type.sizeInBytes == 0u || structClass.type.alignment == 0u)
+	{
+		return false;
+	}
+
+	out_layout.file			= declaringFile;
+	out_layout.name			= structClass.getFullName();
+	out_layout.size			= structClass.type.sizeInBytes;
+	out_layout.alignment	= structClass.type.alignment;
+	out_layout.fields.clear();
+	out_layout.paddingHoles.clear();
+	out_layout.suggestedOrder.clear();
+	out_layout.suggestedSize = out_layout.size;
+
+	for (FieldInfo const& field : structClass.fields)
+	{
+		if (field.isStatic)
+		{
+			continue;
+		}
+
+		//Negative offsets are libclang layout errors
+		if (field.memoryOffset < 0 || field.type.sizeInBytes == 0u)
+		{
+			return false;
+		}
+
+		Field& fieldLayout = out_layout.fields.emplace_back();
+
+		fieldLayout.name		= field.name;
+		fieldLayout.typeName	= field.type.getName();
+		fieldLayout.offset		= static_cast<size_t>(field.memoryOffset);
+		fieldLayout.size		= field.type.sizeInBytes;
+		fieldLayout.alignment	= field.type.alignment;
+
+		size_t lastByte = fieldLayout.offset + fieldLayout.size - 1u;
+		fieldLayout.straddlesCacheLine = fieldLayout.size <= cacheLineSize && fieldLayout.offset / cacheLineSize != lastByte / cacheLineSize;
+	}
+
+	if (out_layout.fields.empty())
+	{
+		return true;
+	}
+
+	std::stable_sort(out_layout.fields.begin(), out_layout.fields.end(), [](Field const& lhs, Field const& rhs) { return lhs.offset < rhs.offset; });
+
+	//Bytes before the first field belong to the base classes / vtable pointer, they are not considered as padding
+	size_t	firstOffset		= out_layout.fields.front().offset;
+	size_t	end				= firstOffset;
+	bool	hasOverlaps		= false;
+
+	for (Field const& field : out_layout.fields)
+	{
+		if (field.offset > end)
+		{
+			out_layout.paddingHoles.push_back(PaddingHole{ end, field.offset - end });
+		}
+		else if (field.offset < end)
+		{
+			//Bit fields share their storage
+			hasOverlaps = true;
+		}
+
+		end = std::max(end, field.offset + field.size);
+	}
+
+	if (out_layout.size > end)
+	{
+		out_layout.paddingHoles.push_back(PaddingHole{ end, out_layout.size - end });
+	}
+
+	if (hasOverlaps)
+	{
+		return true;
+	}
+
+	//Laying fields out by decreasing alignment leaves no hole between them
+	std::vector<Field const*> sortedFields;
+	sortedFields.reserve(out_layout.fields.size());
+
+	for (Field const& field : out_layout.fields)
+	{
+		//Unknown alignment, can't suggest anything reliable
+		if (field.alignment == 0u)
+		{
+			return true;
+		}
+
+		sortedFields.push_back(&field);
+	}
+
+	std::stable_sort(sortedFields.begin(), sortedFields.end(), [](Field const* lhs, Field const* rhs)
+					 {
+						 return (lhs->alignment != rhs->alignment) ? lhs->alignment > rhs->alignment : lhs->size > rhs->size;
+					 });
+
+	size_t offset = firstOffset;
+
+	for (Field const* field : sortedFields)
+	{
+		offset = (offset + field->alignment - 1u) / field->alignment * field->alignment;
+		offset += field->size;
+	}
+
+	size_t suggestedSize = (offset + out_layout.alignment - 1u) / out_layout.alignment * out_layout.alignment;
+
+	if (suggestedSize < out_layout.size)
+	{
+		out_layout.suggestedSize = suggestedSize;
+
+		for (Field const* field : sortedFields)
+		{
+			out_layout.suggestedOrder.push_back(field->name);
+		}
+	}
+
+	return true;
+}
+
+size_t StructLayout::getPaddingSize() const noexcept
+{
+	size_t result = 0u;
+
+	for (PaddingHole const& hole : paddingHoles)
+	{
+		result += hole.size;
+	}
+
+	return result;
+}
+
+size_t StructLayout::getStraddlingFieldsCount() const noexcept
+{
+	return static_cast<size_t>(std::count_if(fields.cbegin(), fields.cend(), [](Field const& field) { return field.straddlesCacheLine; }));
+}
+
+std::string StructLayout::getSummary() const noexcept
+{
+	std::string result = name + " (" + std::to_string(size) + " bytes): " + std::to_string(getPaddingSize()) + " padding bytes";
+
+	if (!suggestedOrder.empty())
+	{
+		result += ", reordering fields as {";
+
+		for (size_t i = 0u; i < suggestedOrder.size(); i++)
+		{
+			result += ((i == 0u) ? "" : ", ") + suggestedOrder[i];
+		}
+
+		result += "} would shrink it to " + std::to_string(suggestedSize) + " bytes";
+	}
+
+	if (getStraddlingFieldsCount() != 0u)
+	{
+		result += ", fields straddling cache lines: ";
+
+		bool isFirst = true;
+
+		for (Field const& field : fields)
+		{
+			if (field.straddlesCacheLine)
+			{
+				result += (isFirst ? "" : ", ") + field.name + " [" + std::to_string(field.offset) + ", " + std::to_string(field.offset + field.size) + ")";
+				isFirst = false;
+			}
+		}
+	}
+
+	return result;
+}
\ No newline at end of file
@@ -1,24 +1,44 @@
 #include "Kodgen/InfoStructures/EntityInfo.h"
 
 #include "Kodgen/Misc/Helpers.h"
+#include "Kodgen/Parsing/ParsedDataScope.h"
 
 using namespace kodgen;
 
 EntityInfo::EntityInfo(CXCursor const& cursor, std::vector<Property>&& properties, EEntityType entityType) noexcept:
 	entityType{entityType},
 	name{Helpers::getString(clang_getCursorDisplayName(cursor))},
-	id{Helpers::getString(clang_getCursorUSR(cursor))},
 	properties{std::forward<std::vector<Property>>(properties)}
 {
+	if (ParsedDataScope::shouldCompute(EParsedData::EntityId))
+	{
+		id = Helpers::getString(clang_getCursorUSR(cursor));
+	}
+
 	auto location = clang_getCursorLocation(cursor);
 	clang_getFileLocation(location, nullptr, &line, &column, &offset);
 }
 
 std::string EntityInfo::getFullName() const noexcept
 {
+	if (!_fullName.empty())
+	{
+		return _fullName.str();
+	}
+
 	return (outerEntity != nullptr) ? outerEntity->getFullName() + "::" + name : name;
 }
 
+InternedString EntityInfo::getInternedFullName() const noexcept
+{
+	return _fullName;
+}
+
+void EntityInfo::cacheFullName() noexcept
+{
+	_fullName = StringInterner::getGlobal().intern((outerEntity != nullptr) ? outerEntity->getFullName() + "::" + name : name);
+}
+
 std::string EntityInfo::getFullName(CXCursor const& cursor) noexcept
 {
 	CXCursor parentCursor = clang_getCursorLexicalParent(cursor);
@@ -7,6 +7,7 @@ using namespace kodgen;
 FieldInfo::FieldInfo(CXCursor const& cursor, std::vector<Property>&& properties) noexcept:
 	VariableInfo(cursor, std::forward<std::vector<Property>>(properties), EEntityType::Field),
 	isMutable{clang_CXXField_isMutable(cursor) != 0u},
+	isBitField{clang_Cursor_isBitField(cursor) != 0u},
 	accessSpecifier{EAccessSpecifier::Invalid},
 	memoryOffset{0}
 {
@@ -22,6 +23,10 @@ FieldInfo::FieldInfo(CXCursor const& cursor, std::vector<Property>&& properties)
 		assert(memoryOffset != CXTypeLayoutError::CXTypeLayoutError_Incomplete);
 		assert(memoryOffset != CXTypeLayoutError::CXTypeLayoutError_InvalidFieldName);
 
-		memoryOffset /= 8;	//From bits to bytes
+		//Layout errors are negative, keep them as is so that an unknown offset is not mistaken for the offset 0
+		if (memoryOffset > 0)
+		{
+			memoryOffset /= 8;	//From bits to bytes
+		}
 	}
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <algorithm>
 
 #include "Kodgen/Misc/Helpers.h"
+#include "Kodgen/Parsing/ParsedDataScope.h"
 
 using namespace kodgen;
 
@@ -23,13 +24,38 @@ TypeInfo::TypeInfo(CXCursor cursor) noexcept
 
 void TypeInfo::initialize(CXType cursorType) noexcept
 {
+	std::string	fullName	= Helpers::getString(clang_getTypeSpelling(cursorType));
+
+	//Remove class or struct keyword
+	removeForwardDeclaredClassQualifier(fullName);
+
+	_fullName = StringInterner::getGlobal().intern(fullName);
+
+	bool	shouldComputeCanonicalName	= ParsedDataScope::shouldCompute(EParsedData::CanonicalTypeName);
+	bool	shouldComputeLayout			= ParsedDataScope::shouldCompute(EParsedData::TypeLayout);
+
+	if (!shouldComputeCanonicalName && !shouldComputeLayout)
+	{
+		_canonicalFullName = _fullName;
+
+		return;
+	}
+
 	CXType	canonicalType = clang_getCanonicalType(cursorType);
 
 	assert(canonicalType.kind != CXTypeKind::CXType_Invalid);
 
-	_fullName			= Helpers::getString(clang_getTypeSpelling(cursorType));
-	_canonicalFullName	= Helpers::getString(clang_getTypeSpelling(canonicalType));
+	//Without canonical name, fallback on the full name so that getCanonicalName is still usable
+	_canonicalFullName = (shouldComputeCanonicalName) ? StringInterner::getGlobal().intern(Helpers::getString(clang_getTypeSpelling(canonicalType))) : _fullName;
 
+	if (shouldComputeLayout)
+	{
+		computeLayout(cursorType, canonicalType);
+	}
+}
+
+void TypeInfo::computeLayout(CXType cursorType, CXType canonicalType) noexcept
+{
 	long long size		= clang_Type_getSizeOf(cursorType);
 
 	if (size == CXTypeLayoutError::CXTypeLayoutError_Invalid ||
@@ -43,8 +69,11 @@ void TypeInfo::initialize(CXType cursorType) noexcept
 		sizeInBytes = static_cast<size_t>(size);
 	}
 
-	//Remove class or struct keyword
-	removeForwardDeclaredClassQualifier(_fullName);
+	long long align		= clang_Type_getAlignOf(cursorType);
+
+	alignment = (align > 0) ? static_cast<size_t>(align) : 0u;
+
+	isPOD = clang_isPODType(canonicalType) != 0u;
 
 	//Fill the descriptors vector
 	TypePart*	currTypePart;
@@ -167,14 +196,14 @@ void TypeInfo::initialize(CXCursor cursor) noexcept
 	switch (cursor.kind)
 	{
 		case CXCursorKind::CXCursor_ClassTemplate:
-			_fullName = computeClassTemplateFullName(cursor);
+			_fullName = StringInterner::getGlobal().intern(computeClassTemplateFullName(cursor));
 			_canonicalFullName = _fullName;	//TODO: Doesn't support canonical result computation for templates for now
 
 			fillTemplateParameters(cursor);
 			break;
 
 		case CXCursorKind::CXCursor_TemplateTemplateParameter:
-			_fullName = Helpers::getString(clang_getCursorSpelling(cursor));
+			_fullName = StringInterner::getGlobal().intern(Helpers::getString(clang_getCursorSpelling(cursor)));
 			_canonicalFullName = _fullName;
 
 			fillTemplateParameters(cursor);
@@ -343,7 +372,7 @@ bool TypeInfo::isTemplateTypename(std::string const& typename_) noexcept
 
 std::string TypeInfo::getName(bool removeQualifiers, bool shouldRemoveNamespacesAndNestedClasses, bool shouldRemoveTemplateParameters) const noexcept
 {
-	std::string result = _fullName;
+	std::string result = _fullName.str();
 
 	if (removeQualifiers)
 	{
@@ -367,7 +396,7 @@ std::string TypeInfo::getName(bool removeQualifiers, bool shouldRemoveNamespaces
 
 std::string TypeInfo::getCanonicalName(bool removeQualifiers, bool shouldRemoveNamespacesAndNestedClasses) const noexcept
 {
-	std::string result = _canonicalFullName;
+	std::string result = _canonicalFullName.str();
 
 	if (removeQualifiers)
 	{
@@ -384,6 +413,16 @@ std::string TypeInfo::getCanonicalName(bool removeQualifiers, bool shouldRemoveN
 	return result;
 }
 
+InternedString TypeInfo::getInternedFullName() const noexcept
+{
+	return _fullName;
+}
+
+InternedString TypeInfo::getInternedCanonicalFullName() const noexcept
+{
+	return _canonicalFullName;
+}
+
 std::vector<TemplateParamInfo> const& TypeInfo::getTemplateParameters() const noexcept
 {
 	return _templateParameters;
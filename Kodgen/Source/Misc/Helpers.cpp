@@ -1,5 +1,7 @@
 #include "Kodgen/Misc/Helpers.h"
 
+#include <cstdio>	//std::snprintf
+
 using namespace kodgen;
 
 std::string Helpers::getString(CXString&& clangString) noexcept
@@ -16,3 +18,63 @@ std::string Helpers::getDebugInfo(CXCursor const& cursor) noexcept
 	return Helpers::getString(clang_getCursorKindSpelling(cursor.kind)) + " -> " + Helpers::getString(clang_getCursorDisplayName(cursor));
 }
 
+std::string Helpers::toJsonString(std::string const& value) noexcept
+{
+	std::string result;
+	result.reserve(value.size() + 2u);
+
+	result += '"';
+
+	for (char c : value)
+	{
+		switch (c)
+		{
+			case '"':
+				result += "\\\"";
+				break;
+
+			case '\\':
+				result += "\\\\";
+				break;
+
+			case '\b':
+				result += "\\b";
+				break;
+
+			case '\f':
+				result += "\\f";
+				break;
+
+			case '\n':
+				result += "\\n";
+				break;
+
+			case '\r':
+				result += "\\r";
+				break;
+
+			case '\t':
+				result += "\\t";
+				break;
+
+			default:
+				//Other control characters are not allowed in JSON strings
+				if (static_cast<unsigned char>(c) < 0x20u)
+				{
+					char escapedChar[7];
+					std::snprintf(escapedChar, sizeof(escapedChar), "\\u%04x", static_cast<unsigned int>(c));
+
+					result += escapedChar;
+				}
+				else
+				{
+					result += c;
+				}
+				break;
+		}
+	}
+
+	result += '"';
+
+	return result;
+}
\ No newline at end of file
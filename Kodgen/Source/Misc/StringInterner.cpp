@@ -0,0 +1,50 @@
+#include "Kodgen/Misc/StringInterner.h"
+
+#include <mutex>	//std::unique_lock
+
+using namespace kodgen;
+
+InternedString::InternedString(std::string const* string) noexcept:
+	_string{string}
+{
+}
+
+InternedString StringInterner::intern(std::string_view string) noexcept
+{
+	//The empty string is never stored so that its handle is equal to the default one
+	if (string.empty())
+	{
+		return InternedString();
+	}
+
+	//Most strings (type names especially) are already interned, so try with a shared lock first
+	{
+		std::shared_lock lock(_mutex);
+
+		auto it = _strings.find(string);
+
+		if (it != _strings.cend())
+		{
+			return InternedString(&*it);
+		}
+	}
+
+	std::unique_lock lock(_mutex);
+
+	//emplace doesn't insert anything if another thread interned the same string in the meantime
+	return InternedString(&*_strings.emplace(string).first);
+}
+
+size_t StringInterner::size() const noexcept
+{
+	std::shared_lock lock(_mutex);
+
+	return _strings.size();
+}
+
+StringInterner& StringInterner::getGlobal() noexcept
+{
+	static StringInterner interner;
+
+	return interner;
+}
\ No newline at end of file
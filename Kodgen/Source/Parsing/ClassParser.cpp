@@ -42,7 +42,7 @@ CXChildVisitResult ClassParser::parse(CXCursor classCursor, ParsingContext const
 	DISABLE_WARNING_PUSH
 	DISABLE_WARNING_UNSCOPED_ENUM
 
-	return (parentContext.parsingSettings->shouldAbortParsingOnFirstError && !out_result.errors.empty()) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
+	return shouldAbortParsing(parentContext, out_result) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
 
 	DISABLE_WARNING_POP
 }
@@ -52,6 +52,12 @@ CXChildVisitResult ClassParser::parseNestedEntity(CXCursor cursor, CXCursor /* p
 	ClassParser*	parser	= reinterpret_cast<ClassParser*>(clientData);
 	ParsingContext&	context = parser->getContext();
 
+	//The whole run has been cancelled, stop visiting as soon as possible
+	if (parser->isCancelled())
+	{
+		return CXChildVisitResult::CXChildVisit_Break;
+	}
+
 	if (context.shouldCheckProperties)
 	{
 		//If the parsed class is a class template, skip template parameters
@@ -206,6 +212,7 @@ ParsingContext& ClassParser::pushContext(CXCursor const& classCursor, ParsingCon
 	newContext.shouldCheckProperties	= true;
 	newContext.propertyParser			= parentContext.propertyParser;
 	newContext.parsingSettings			= parentContext.parsingSettings;
+	newContext.cancellationToken		= parentContext.cancellationToken;
 	newContext.structClassTree			= parentContext.structClassTree;
 	newContext.parsingResult			= &out_result;
 	newContext.currentAccessSpecifier	= (StructClassInfo::getCursorKind(classCursor) == CXCursorKind::CXCursor_ClassDecl) ? EAccessSpecifier::Private : EAccessSpecifier::Public;
@@ -11,4 +11,10 @@ void EntityParser::updateShouldParseAllNested(EntityInfo const& parsingEntity) n
 	getContext().shouldParseAllNested = std::find_if(parsingEntity.properties.cbegin(), parsingEntity.properties.cend(),
 													 [](Property const& prop) { return prop.name == NativeProperties::parseAllNestedProperty; })
 												!= parsingEntity.properties.cend();
+}
+
+bool EntityParser::shouldAbortParsing(ParsingContext const& parentContext, ParsingResultBase const& result) noexcept
+{
+	return	(parentContext.cancellationToken != nullptr && parentContext.cancellationToken->isCancelled()) ||
+			(parentContext.parsingSettings->shouldAbortParsingOnFirstError && !result.errors.empty());
 }
\ No newline at end of file
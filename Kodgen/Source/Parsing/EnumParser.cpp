@@ -31,7 +31,7 @@ CXChildVisitResult EnumParser::parse(CXCursor const& enumCursor, ParsingContext
 	DISABLE_WARNING_PUSH
 	DISABLE_WARNING_UNSCOPED_ENUM
 
-	return (parentContext.parsingSettings->shouldAbortParsingOnFirstError && !out_result.errors.empty()) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
+	return shouldAbortParsing(parentContext, out_result) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
 
 	DISABLE_WARNING_POP
 }
@@ -41,6 +41,12 @@ CXChildVisitResult EnumParser::parseNestedEntity(CXCursor cursor, CXCursor /* pa
 	EnumParser*		parser	= reinterpret_cast<EnumParser*>(clientData);
 	ParsingContext&	context = parser->getContext();
 
+	//The whole run has been cancelled, stop visiting as soon as possible
+	if (parser->isCancelled())
+	{
+		return CXChildVisitResult::CXChildVisit_Break;
+	}
+
 	if (context.shouldCheckProperties)
 	{
 		context.shouldCheckProperties = false;
@@ -141,6 +147,7 @@ ParsingContext& EnumParser::pushContext(CXCursor const& enumCursor, ParsingConte
 	newContext.shouldCheckProperties	= true;
 	newContext.propertyParser			= parentContext.propertyParser;
 	newContext.parsingSettings			= parentContext.parsingSettings;
+	newContext.cancellationToken		= parentContext.cancellationToken;
 	newContext.parsingResult			= &out_result;
 
 	contextsStack.push(std::move(newContext));
@@ -30,7 +30,7 @@ CXChildVisitResult EnumValueParser::parse(CXCursor const& enumValueCursor, Parsi
 	DISABLE_WARNING_PUSH
 	DISABLE_WARNING_UNSCOPED_ENUM
 
-	return (parentContext.parsingSettings->shouldAbortParsingOnFirstError && !out_result.errors.empty()) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
+	return shouldAbortParsing(parentContext, out_result) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
 
 	DISABLE_WARNING_POP
 }
@@ -125,6 +125,7 @@ ParsingContext& EnumValueParser::pushContext(CXCursor const& enumValueCursor, Pa
 	newContext.shouldCheckProperties	= true;
 	newContext.propertyParser			= parentContext.propertyParser;
 	newContext.parsingSettings			= parentContext.parsingSettings;
+	newContext.cancellationToken		= parentContext.cancellationToken;
 	newContext.parsingResult			= &out_result;
 
 	contextsStack.push(std::move(newContext));
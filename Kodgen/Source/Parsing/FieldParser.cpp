@@ -31,7 +31,7 @@ CXChildVisitResult FieldParser::parse(CXCursor const& fieldCursor, ParsingContex
 	DISABLE_WARNING_PUSH
 	DISABLE_WARNING_UNSCOPED_ENUM
 
-	return (parentContext.parsingSettings->shouldAbortParsingOnFirstError && !out_result.errors.empty()) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
+	return shouldAbortParsing(parentContext, out_result) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
 
 	DISABLE_WARNING_POP
 }
@@ -103,6 +103,7 @@ ParsingContext& FieldParser::pushContext(CXCursor const& fieldCursor, ParsingCon
 	newContext.shouldCheckProperties	= true;
 	newContext.propertyParser			= parentContext.propertyParser;
 	newContext.parsingSettings			= parentContext.parsingSettings;
+	newContext.cancellationToken		= parentContext.cancellationToken;
 	newContext.parsingResult			= &out_result;
 
 	contextsStack.push(std::move(newContext));
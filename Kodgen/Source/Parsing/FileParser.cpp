@@ -5,10 +5,16 @@
 #include "Kodgen/Misc/Helpers.h"
 #include "Kodgen/Misc/DisableWarningMacros.h"
 #include "Kodgen/Misc/TomlUtility.h"
+#include "Kodgen/Parsing/ParsedDataScope.h"
 
 #include <algorithm>
 #include <functional>
 #include <sstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <system_error>
 
 using namespace kodgen;
 
@@ -23,7 +29,9 @@ FileParser::FileParser(FileParser const& other) noexcept :
 	NamespaceParser(other),
 	_clangIndex{ clang_createIndex(0, 0) },	//Don't copy clang index, create a new one
 	_settings{ other._settings },
-	logger{ other.logger }
+	logger{ other.logger },
+	cancellationToken{ other.cancellationToken },
+	timedOutParsingsJoiner{ other.timedOutParsingsJoiner }
 {
 }
 
@@ -32,7 +40,9 @@ FileParser::FileParser(FileParser&& other) noexcept :
 	_clangIndex{ std::forward<CXIndex>(other._clangIndex) },
 	_propertyParser(std::forward<PropertyParser>(other._propertyParser)),
 	_settings{ other._settings },
-	logger{ other.logger }
+	logger{ other.logger },
+	cancellationToken{ other.cancellationToken },
+	timedOutParsingsJoiner{ other.timedOutParsingsJoiner }
 {
 	other._clangIndex = nullptr;
 }
@@ -53,31 +63,57 @@ bool FileParser::parse(fs::path const& toParseFile, FileParsingResult& out_resul
 
 	preParse(toParseFile);
 
-	if (fs::exists(toParseFile) && !fs::is_directory(toParseFile))
+	if (cancellationToken != nullptr && cancellationToken->isCancelled())
+	{
+		out_result.errors.emplace_back("Parsing of file " + toParseFile.string() + " has been cancelled.");
+	}
+	else if (fs::exists(toParseFile) && !fs::is_directory(toParseFile))
 	{
 		//Fill the parsed file info
 		out_result.parsedFile = FilesystemHelpers::sanitizePath(toParseFile);
 
-		// Extracting file id
-		auto filePathStr = out_result.parsedFile.string();
-		out_result.fileId = "FID_" + std::to_string(std::hash<std::string>{}(filePathStr));
+		out_result.fileId = computeFileId(out_result.parsedFile);
 
 		//Parse the given file
-		CXTranslationUnit translationUnit = clang_parseTranslationUnit(_clangIndex, toParseFile.string().c_str(), _settings->getCompilationArguments().data(), static_cast<int32>(_settings->getCompilationArguments().size()), nullptr, 0, CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_Incomplete | CXTranslationUnit_KeepGoing);
+		CXTranslationUnit translationUnit = parseTranslationUnit(toParseFile, out_result);
 
-		if (translationUnit != nullptr)
+		if (out_result.timedOut)
 		{
-			ParsingContext& context = pushContext(translationUnit, out_result);
+			out_result.errors.emplace_back("Parsing of file " + toParseFile.string() + " timed out after " + std::to_string(out_result.parsingDuration) + "s.");
+		}
+		else if (translationUnit != nullptr)
+		{
+			ParsingContext& context				= pushContext(translationUnit, out_result);
+			auto			traversalStart		= std::chrono::steady_clock::now();
+			ParsedDataScope	parsedDataScope(_settings->parsedData);
+			bool			traversalAborted	= clang_visitChildren(context.rootCursor, &FileParser::parseNestedEntity, this);
+
+			out_result.traversalDuration		= std::chrono::duration<float>(std::chrono::steady_clock::now() - traversalStart).count();
+			out_result.propertyParsingDuration	= _propertyParser.getParsingDuration();
 
-			if (clang_visitChildren(context.rootCursor, &FileParser::parseNestedEntity, this) || !out_result.errors.empty())
+			if (traversalAborted || !out_result.errors.empty())
 			{
 				//ERROR
+				if (out_result.errors.empty() && isCancelled())
+				{
+					//Make sure a partially visited file is never forwarded to code generation
+					out_result.errors.emplace_back("Parsing of file " + toParseFile.string() + " has been cancelled.");
+				}
 			}
 			else
 			{
 				//Refresh all outer entities contained in the final result
 				refreshOuterEntity(out_result);
 
+				out_result.entityIndex.build(out_result);
+				assert(out_result.entityIndex.matchesTreeTraversal(out_result));
+
+				//Compute qualified names once, the index visiting outer entities before their nested entities
+				out_result.foreachEntityOfType(NamespaceInfo::nestedEntityTypes | EEntityType::EnumValue, [](EntityInfo const& entity)
+											   {
+												   const_cast<EntityInfo&>(entity).cacheFullName();
+											   });
+
 				isSuccess = true;
 			}
 
@@ -108,10 +144,144 @@ bool FileParser::parse(fs::path const& toParseFile, FileParsingResult& out_resul
 	return isSuccess;
 }
 
+std::string FileParser::computeFileId(fs::path const& parsedFile) const noexcept
+{
+	fs::path const& projectRootDirectory = _settings->getProjectRootDirectory();
+	fs::path		identifyingPath;
+
+	if (!projectRootDirectory.empty() && FilesystemHelpers::isChildPath(parsedFile, projectRootDirectory))
+	{
+		identifyingPath = parsedFile.lexically_relative(projectRootDirectory);
+	}
+	else
+	{
+		identifyingPath = parsedFile;
+	}
+
+	return "FID_" + std::to_string(Helpers::fnv1a64(FilesystemHelpers::normalizeSeparator(identifyingPath).string()));
+}
+
+CXTranslationUnit FileParser::parseTranslationUnit(fs::path const& toParseFile, FileParsingResult& out_result) noexcept
+{
+	constexpr unsigned int	parsingOptions		= CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_Incomplete | CXTranslationUnit_KeepGoing;
+	auto					start				= std::chrono::steady_clock::now();
+	CXTranslationUnit		translationUnit		= nullptr;
+
+	if (_settings->parseTimeout <= 0.0f)
+	{
+		clang_parseTranslationUnit2(_clangIndex, toParseFile.string().c_str(), _settings->getCompilationArguments().data(), static_cast<int32>(_settings->getCompilationArguments().size()), nullptr, 0, parsingOptions, &translationUnit);
+	}
+	else
+	{
+		/**
+		*	libclang can't interrupt a running parsing, so it is run on a helper thread using this parser's index.
+		*	If the budget is exceeded, the helper thread is handed to timedOutParsingsJoiner along with the index,
+		*	and disposes the index whenever libclang returns.
+		*/
+		struct WatchedParsing
+		{
+			std::mutex							mutex;
+			std::condition_variable				condition;
+			std::shared_ptr<ParsingSettings>	settings;	//Keeps the compilation arguments alive for the helper thread
+			std::string							filePath;
+			CXIndex								clangIndex		= nullptr;
+			CXTranslationUnit					translationUnit	= nullptr;
+			bool								finished		= false;
+			bool								abandoned		= false;
+		};
+
+		std::shared_ptr<WatchedParsing> watchedParsing = std::make_shared<WatchedParsing>();
+		watchedParsing->settings	= _settings;
+		watchedParsing->filePath	= toParseFile.string();
+		watchedParsing->clangIndex	= _clangIndex;
+
+		auto parsingLambda = [watchedParsing]()
+		{
+			CXTranslationUnit translationUnit = nullptr;
+
+			clang_parseTranslationUnit2(watchedParsing->clangIndex, watchedParsing->filePath.c_str(), watchedParsing->settings->getCompilationArguments().data(), static_cast<int32>(watchedParsing->settings->getCompilationArguments().size()), nullptr, 0, parsingOptions, &translationUnit);
+
+			std::unique_lock lock(watchedParsing->mutex);
+
+			if (watchedParsing->abandoned)
+			{
+				lock.unlock();
+
+				if (translationUnit != nullptr)
+				{
+					clang_disposeTranslationUnit(translationUnit);
+				}
+
+				clang_disposeIndex(watchedParsing->clangIndex);
+			}
+			else
+			{
+				watchedParsing->translationUnit	= translationUnit;
+				watchedParsing->finished		= true;
+
+				lock.unlock();
+
+				watchedParsing->condition.notify_one();
+			}
+		};
+
+		std::thread helperThread;
+
+		try
+		{
+			helperThread = std::thread(parsingLambda);
+		}
+		catch (std::system_error const&)
+		{
+			//No more thread can be started, parse on this thread without timeout
+			parsingLambda();
+		}
+
+		std::unique_lock lock(watchedParsing->mutex);
+
+		if (watchedParsing->condition.wait_for(lock, std::chrono::duration<float>(_settings->parseTimeout), [&watchedParsing]() { return watchedParsing->finished; }))
+		{
+			translationUnit = watchedParsing->translationUnit;
+		}
+		else
+		{
+			//The helper thread keeps using the index until libclang returns
+			watchedParsing->abandoned = true;
+			_clangIndex = clang_createIndex(0, 0);
+
+			out_result.timedOut = true;
+		}
+
+		lock.unlock();
+
+		if (helperThread.joinable())
+		{
+			if (watchedParsing->abandoned && timedOutParsingsJoiner != nullptr)
+			{
+				timedOutParsingsJoiner->adopt(std::move(helperThread));
+			}
+			else
+			{
+				helperThread.join();
+			}
+		}
+	}
+
+	out_result.parsingDuration = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	return translationUnit;
+}
+
 CXChildVisitResult FileParser::parseNestedEntity(CXCursor cursor, CXCursor /* parentCursor */, CXClientData clientData) noexcept
 {
 	FileParser* parser = reinterpret_cast<FileParser*>(clientData);
 
+	//The whole run has been cancelled, stop visiting as soon as possible
+	if (parser->isCancelled())
+	{
+		return CXChildVisitResult::CXChildVisit_Break;
+	}
+
 	DISABLE_WARNING_PUSH
 		DISABLE_WARNING_UNSCOPED_ENUM
 
@@ -170,6 +340,7 @@ ParsingContext& FileParser::pushContext(CXTranslationUnit const& translationUnit
 	newContext.parsingSettings = _settings.get();
 	newContext.structClassTree = &out_result.structClassTree;
 	newContext.parsingResult = &out_result;
+	newContext.cancellationToken = cancellationToken;
 
 	contextsStack.push(std::move(newContext));
 
@@ -31,7 +31,7 @@ CXChildVisitResult FunctionParser::parse(CXCursor const& functionCursor, Parsing
 	DISABLE_WARNING_PUSH
 	DISABLE_WARNING_UNSCOPED_ENUM
 
-	return (parentContext.parsingSettings->shouldAbortParsingOnFirstError && !out_result.errors.empty()) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
+	return shouldAbortParsing(parentContext, out_result) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
 
 	DISABLE_WARNING_POP
 }
@@ -126,6 +126,7 @@ ParsingContext& FunctionParser::pushContext(CXCursor const& methodCursor, Parsin
 	newContext.shouldCheckProperties	= true;
 	newContext.propertyParser			= parentContext.propertyParser;
 	newContext.parsingSettings			= parentContext.parsingSettings;
+	newContext.cancellationToken		= parentContext.cancellationToken;
 	newContext.parsingResult			= &out_result;
 
 	contextsStack.push(std::move(newContext));
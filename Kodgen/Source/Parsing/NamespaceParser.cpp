@@ -32,7 +32,7 @@ CXChildVisitResult NamespaceParser::parse(CXCursor const& namespaceCursor, Parsi
 	DISABLE_WARNING_PUSH
 	DISABLE_WARNING_UNSCOPED_ENUM
 
-	return (parentContext.parsingSettings->shouldAbortParsingOnFirstError && !out_result.errors.empty()) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
+	return shouldAbortParsing(parentContext, out_result) ? CXChildVisitResult::CXChildVisit_Break : CXChildVisitResult::CXChildVisit_Continue;
 
 	DISABLE_WARNING_POP
 }
@@ -42,6 +42,12 @@ CXChildVisitResult NamespaceParser::parseNestedEntity(CXCursor cursor, CXCursor
 	NamespaceParser*	parser	= reinterpret_cast<NamespaceParser*>(clientData);
 	ParsingContext&		context = parser->getContext();
 
+	//The whole run has been cancelled, stop visiting as soon as possible
+	if (parser->isCancelled())
+	{
+		return CXChildVisitResult::CXChildVisit_Break;
+	}
+
 	if (context.shouldCheckProperties)
 	{
 		context.shouldCheckProperties = false;
@@ -136,6 +142,7 @@ ParsingContext& NamespaceParser::pushContext(CXCursor const& namespaceCursor, Pa
 	newContext.shouldCheckProperties	= true;
 	newContext.propertyParser			= parentContext.propertyParser;
 	newContext.parsingSettings			= parentContext.parsingSettings;
+	newContext.cancellationToken		= parentContext.cancellationToken;
 	newContext.structClassTree			= parentContext.structClassTree;
 	newContext.parsingResult			= &out_result;
 
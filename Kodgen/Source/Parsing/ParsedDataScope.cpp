@@ -0,0 +1,21 @@
+#include "Kodgen/Parsing/ParsedDataScope.h"
+
+using namespace kodgen;
+
+thread_local EParsedData ParsedDataScope::_current = EParsedData::All;
+
+ParsedDataScope::ParsedDataScope(EParsedData parsedData) noexcept:
+	_previous{_current}
+{
+	_current = parsedData;
+}
+
+ParsedDataScope::~ParsedDataScope() noexcept
+{
+	_current = _previous;
+}
+
+bool ParsedDataScope::shouldCompute(EParsedData parsedData) noexcept
+{
+	return (_current & parsedData) == parsedData;
+}
\ No newline at end of file
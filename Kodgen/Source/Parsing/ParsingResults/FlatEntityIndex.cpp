@@ -0,0 +1,287 @@
+#include "Kodgen/Parsing/ParsingResults/FlatEntityIndex.h"
+
+#include <algorithm>	//std::reverse
+#include <bit>		//std::has_single_bit
+#include <cassert>
+
+#include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
+
+using namespace kodgen;
+
+/**
+*	@brief Get an entity from the container of a file or namespace matching its type.
+*/
+template <typename ScopeType>
+static EntityInfo const& getScopeEntity(ScopeType const& scope, FlatEntityIndex::Node const& node) noexcept
+{
+	switch (node.type)
+	{
+		case EEntityType::Namespace:
+			return scope.namespaces[node.indexInParent];
+
+		case EEntityType::Class:
+			return scope.classes[node.indexInParent];
+
+		case EEntityType::Struct:
+			return scope.structs[node.indexInParent];
+
+		case EEntityType::Enum:
+			return scope.enums[node.indexInParent];
+
+		case EEntityType::Function:
+			return scope.functions[node.indexInParent];
+
+		case EEntityType::Variable:
+			[[fallthrough]];
+		default:
+			assert(node.type == EEntityType::Variable);
+			return scope.variables[node.indexInParent];
+	}
+}
+
+static EntityInfo const& getStructClassEntity(StructClassInfo const& struct_, FlatEntityIndex::Node const& node) noexcept
+{
+	switch (node.type)
+	{
+		case EEntityType::Class:
+			return *struct_.nestedClasses[node.indexInParent];
+
+		case EEntityType::Struct:
+			return *struct_.nestedStructs[node.indexInParent];
+
+		case EEntityType::Enum:
+			return struct_.nestedEnums[node.indexInParent];
+
+		case EEntityType::Field:
+			return struct_.fields[node.indexInParent];
+
+		case EEntityType::Method:
+			[[fallthrough]];
+		default:
+			assert(node.type == EEntityType::Method);
+			return struct_.methods[node.indexInParent];
+	}
+}
+
+size_t FlatEntityIndex::getTypeIndex(EEntityType entityType) noexcept
+{
+	assert(std::has_single_bit(static_cast<std::underlying_type_t<EEntityType>>(entityType)));	//Must be a single entity type, not a mask
+
+	return getEntityTypeIndex(entityType);
+}
+
+uint32 FlatEntityIndex::addNode(EEntityType type, uint32 parent, uint32 indexInParent) noexcept
+{
+	uint32 nodeIndex = static_cast<uint32>(_nodes.size());
+
+	_nodes.push_back(Node{ parent, indexInParent, nodeIndex + 1u, type });
+	_nodesPerType[getTypeIndex(type)].push_back(nodeIndex);
+
+	return nodeIndex;
+}
+
+template <typename ScopeType>
+void FlatEntityIndex::addScopeNodes(ScopeType const& scope, uint32 parent) noexcept
+{
+	//Same order as the tree traversal of FileParsingResult::foreachEntityOfType
+	for (uint32 i = 0u; i < scope.namespaces.size(); i++)
+	{
+		addNamespaceNodes(scope.namespaces[i], parent, i);
+	}
+
+	for (uint32 i = 0u; i < scope.classes.size(); i++)
+	{
+		addStructClassNodes(scope.classes[i], parent, i);
+	}
+
+	for (uint32 i = 0u; i < scope.structs.size(); i++)
+	{
+		addStructClassNodes(scope.structs[i], parent, i);
+	}
+
+	for (uint32 i = 0u; i < scope.enums.size(); i++)
+	{
+		addEnumNodes(scope.enums[i], parent, i);
+	}
+
+	for (uint32 i = 0u; i < scope.functions.size(); i++)
+	{
+		addNode(EEntityType::Function, parent, i);
+	}
+
+	for (uint32 i = 0u; i < scope.variables.size(); i++)
+	{
+		addNode(EEntityType::Variable, parent, i);
+	}
+}
+
+void FlatEntityIndex::addNamespaceNodes(NamespaceInfo const& namespace_, uint32 parent, uint32 indexInParent) noexcept
+{
+	uint32 nodeIndex = addNode(EEntityType::Namespace, parent, indexInParent);
+
+	addScopeNodes(namespace_, nodeIndex);
+
+	_nodes[nodeIndex].subtreeEnd = static_cast<uint32>(_nodes.size());
+}
+
+void FlatEntityIndex::addStructClassNodes(StructClassInfo const& struct_, uint32 parent, uint32 indexInParent) noexcept
+{
+	uint32 nodeIndex = addNode(struct_.entityType, parent, indexInParent);
+
+	for (uint32 i = 0u; i < struct_.nestedStructs.size(); i++)
+	{
+		addStructClassNodes(*struct_.nestedStructs[i], nodeIndex, i);
+	}
+
+	for (uint32 i = 0u; i < struct_.nestedClasses.size(); i++)
+	{
+		addStructClassNodes(*struct_.nestedClasses[i], nodeIndex, i);
+	}
+
+	for (uint32 i = 0u; i < struct_.nestedEnums.size(); i++)
+	{
+		addEnumNodes(struct_.nestedEnums[i], nodeIndex, i);
+	}
+
+	for (uint32 i = 0u; i < struct_.fields.size(); i++)
+	{
+		addNode(EEntityType::Field, nodeIndex, i);
+	}
+
+	for (uint32 i = 0u; i < struct_.methods.size(); i++)
+	{
+		addNode(EEntityType::Method, nodeIndex, i);
+	}
+
+	_nodes[nodeIndex].subtreeEnd = static_cast<uint32>(_nodes.size());
+}
+
+void FlatEntityIndex::addEnumNodes(EnumInfo const& enum_, uint32 parent, uint32 indexInParent) noexcept
+{
+	uint32 nodeIndex = addNode(EEntityType::Enum, parent, indexInParent);
+
+	for (uint32 i = 0u; i < enum_.enumValues.size(); i++)
+	{
+		addNode(EEntityType::EnumValue, nodeIndex, i);
+	}
+
+	_nodes[nodeIndex].subtreeEnd = static_cast<uint32>(_nodes.size());
+}
+
+void FlatEntityIndex::build(FileParsingResult const& fileParsingResult) noexcept
+{
+	clear();
+
+	addScopeNodes(fileParsingResult, invalidIndex);
+}
+
+void FlatEntityIndex::clear() noexcept
+{
+	_nodes.clear();
+
+	for (std::vector<uint32>& nodes : _nodesPerType)
+	{
+		nodes.clear();
+	}
+}
+
+bool FlatEntityIndex::empty() const noexcept
+{
+	return _nodes.empty();
+}
+
+std::vector<FlatEntityIndex::Node> const& FlatEntityIndex::getNodes() const noexcept
+{
+	return _nodes;
+}
+
+std::vector<uint32> const& FlatEntityIndex::getNodesOfType(EEntityType entityType) const noexcept
+{
+	return _nodesPerType[getTypeIndex(entityType)];
+}
+
+EntityInfo const& FlatEntityIndex::getEntity(FileParsingResult const& fileParsingResult, EntityInfo const* parentEntity, Node const& node) noexcept
+{
+	if (parentEntity == nullptr)
+	{
+		return getScopeEntity(fileParsingResult, node);
+	}
+
+	switch (parentEntity->entityType)
+	{
+		case EEntityType::Namespace:
+			return getScopeEntity(static_cast<NamespaceInfo const&>(*parentEntity), node);
+
+		case EEntityType::Class:
+			[[fallthrough]];
+		case EEntityType::Struct:
+			return getStructClassEntity(static_cast<StructClassInfo const&>(*parentEntity), node);
+
+		case EEntityType::Enum:
+			[[fallthrough]];
+		default:
+			assert(parentEntity->entityType == EEntityType::Enum && node.type == EEntityType::EnumValue);
+			return static_cast<EnumInfo const&>(*parentEntity).enumValues[node.indexInParent];
+	}
+}
+
+EntityInfo const& FlatEntityIndex::getEntity(FileParsingResult const& fileParsingResult, uint32 nodeIndex) const noexcept
+{
+	Node const& node = _nodes[nodeIndex];
+
+	return getEntity(fileParsingResult, (node.parent == invalidIndex) ? nullptr : &getEntity(fileParsingResult, node.parent), node);
+}
+
+EntityInfo const& FlatEntityIndex::resolveEntity(FileParsingResult const& fileParsingResult, uint32 nodeIndex,
+												 std::vector<std::pair<uint32, EntityInfo const*>>& inout_ancestors) const noexcept
+{
+	Node const& node = _nodes[nodeIndex];
+
+	//Drop the ancestors of the previous node whose subtree doesn't contain this node
+	while (!inout_ancestors.empty() && _nodes[inout_ancestors.back().first].subtreeEnd <= nodeIndex)
+	{
+		inout_ancestors.pop_back();
+	}
+
+	//Add the missing ancestors, walking up to the innermost kept one
+	size_t	keptAncestorsCount	= inout_ancestors.size();
+	uint32	innermostKept		= inout_ancestors.empty() ? invalidIndex : inout_ancestors.back().first;
+
+	for (uint32 ancestor = node.parent; ancestor != innermostKept; ancestor = _nodes[ancestor].parent)
+	{
+		inout_ancestors.emplace_back(ancestor, nullptr);
+	}
+
+	std::reverse(inout_ancestors.begin() + keptAncestorsCount, inout_ancestors.end());
+
+	for (size_t i = keptAncestorsCount; i < inout_ancestors.size(); i++)
+	{
+		inout_ancestors[i].second = &getEntity(fileParsingResult, (i == 0u) ? nullptr : inout_ancestors[i - 1u].second, _nodes[inout_ancestors[i].first]);
+	}
+
+	return getEntity(fileParsingResult, inout_ancestors.empty() ? nullptr : inout_ancestors.back().second, node);
+}
+
+bool FlatEntityIndex::matchesTreeTraversal(FileParsingResult const& fileParsingResult) const noexcept
+{
+	std::vector<EntityInfo const*> indexEntities;
+	std::vector<EntityInfo const*> treeEntities;
+
+	for (size_t i = 0u; i <= entityTypesCount; i++)
+	{
+		EEntityType entityMask = (i < entityTypesCount) ? static_cast<EEntityType>(1u << i) : allEntityTypes;
+
+		indexEntities.clear();
+		treeEntities.clear();
+
+		foreachEntityOfType(fileParsingResult, entityMask, [&indexEntities](EntityInfo const& entity) { indexEntities.push_back(&entity); });
+		fileParsingResult.foreachEntityOfTypeInTree(entityMask, [&treeEntities](EntityInfo const& entity) { treeEntities.push_back(&entity); });
+
+		if (indexEntities != treeEntities)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -164,8 +164,10 @@ bool ParsingSettings::loadSettingsValues(toml::value const& tomlData, ILogger* l
 		loadShouldParseAllEntities(tomlParsingSettings, logger);
 		loadShouldAbortParsingOnFirstError(tomlParsingSettings, logger);
 		loadShouldLogDiagnostic(tomlParsingSettings, logger);
+		loadParseTimeout(tomlParsingSettings, logger);
 		loadCompilerExeName(tomlParsingSettings, logger);
 		loadProjectIncludeDirectories(tomlParsingSettings, logger);
+		loadProjectRootDirectory(tomlParsingSettings, logger);
 
 		return propertyParsingSettings.loadSettingsValues(tomlParsingSettings, logger);
 	}
@@ -266,6 +268,14 @@ void ParsingSettings::loadShouldLogDiagnostic(toml::value const& tomlFileParsing
 	}
 }
 
+void ParsingSettings::loadParseTimeout(toml::value const& tomlFileParsingSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(tomlFileParsingSettings, "parseTimeout", parseTimeout, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load parseTimeout: " + std::to_string(parseTimeout) + "s");
+	}
+}
+
 void ParsingSettings::loadCompilerExeName(toml::value const& parsingSettings, ILogger* logger) noexcept
 {
 	std::string compilerExeName;
@@ -322,6 +332,29 @@ void ParsingSettings::loadProjectIncludeDirectories(toml::value const& parsingSe
 	}
 }
 
+void ParsingSettings::loadProjectRootDirectory(toml::value const& parsingSettings, ILogger* logger) noexcept
+{
+	fs::path projectRootDirectory;
+
+	if (TomlUtility::updateSetting(parsingSettings, "projectRootDirectory", projectRootDirectory, logger))
+	{
+		bool success = setProjectRootDirectory(projectRootDirectory);
+
+		//Log load result
+		if (logger != nullptr)
+		{
+			if (success)
+			{
+				logger->log("[TOML] Load project root directory: " + _projectRootDirectory.string());
+			}
+			else
+			{
+				logger->log("[TOML] Discard project root directory as it doesn't exist or is not a directory: " + projectRootDirectory.string(), ILogger::ELogSeverity::Warning);
+			}
+		}
+	}
+}
+
 bool ParsingSettings::addProjectIncludeDirectory(fs::path const& directoryPath) noexcept
 {
 	fs::path sanitizedPath = FilesystemHelpers::sanitizePath(directoryPath);
@@ -349,6 +382,25 @@ std::unordered_set<fs::path, PathHash> const& ParsingSettings::getProjectInclude
 	return _projectIncludeDirectories;
 }
 
+bool ParsingSettings::setProjectRootDirectory(fs::path const& directoryPath) noexcept
+{
+	fs::path sanitizedPath = FilesystemHelpers::sanitizePath(directoryPath);
+
+	if (!sanitizedPath.empty() && fs::is_directory(sanitizedPath))
+	{
+		_projectRootDirectory = std::move(sanitizedPath);
+
+		return true;
+	}
+
+	return false;
+}
+
+fs::path const& ParsingSettings::getProjectRootDirectory() const noexcept
+{
+	return _projectRootDirectory;
+}
+
 std::string const& ParsingSettings::getCompilerExeName() const noexcept
 {
 	return _compilerExeName;
@@ -1,18 +1,24 @@
 #include "Kodgen/Parsing/PropertyParser.h"
 
 #include <cassert>
+#include <chrono>
 
 #include "Kodgen/Properties/Property.h"
 
 using namespace kodgen;
 
-opt::optional<std::vector<Property>> PropertyParser::getProperties(std::string&& annotateMessage, std::string const& annotationId) noexcept
+opt::optional<std::vector<Property>> PropertyParser::getProperties(std::string_view annotateMessage, std::string_view annotationId) noexcept
 {
-	if (annotateMessage.substr(0, annotationId.size()) == annotationId)
+	auto									start = std::chrono::steady_clock::now();
+	opt::optional<std::vector<Property>>	result;
+
+	if (annotateMessage.starts_with(annotationId))
 	{
-		if (splitProperties(annotateMessage.substr(annotationId.size())))
+		std::vector<Property> properties;
+
+		if (splitProperties(annotateMessage.substr(annotationId.size()), properties))
 		{
-			return fillProperties(_splitProps);
+			result = std::move(properties);
 		}
 	}
 	else
@@ -20,87 +26,91 @@ opt::optional<std::vector<Property>> PropertyParser::getProperties(std::string&&
 		_parsingErrorDescription = "The wrong macro has been used to attach properties to an entity.";
 	}
 
-	assert(!_parsingErrorDescription.empty());	//If fails, _parsingErrorDescription must be updated
-	return opt::nullopt;
+	assert(result.has_value() || !_parsingErrorDescription.empty());	//If fails, _parsingErrorDescription must be updated
+
+	_parsingDuration += std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	return result;
 }
 
 opt::optional<std::vector<Property>> PropertyParser::getNamespaceProperties(std::string annotateMessage) noexcept
 {
-	static std::string namespaceAnnotation = "KGN:";
+	static constexpr std::string_view namespaceAnnotation = "KGN:";
 
-	return getProperties(std::move(annotateMessage), namespaceAnnotation);
+	return getProperties(annotateMessage, namespaceAnnotation);
 }
 
 opt::optional<std::vector<Property>> PropertyParser::getClassProperties(std::string annotateMessage) noexcept
 {
-	static std::string classAnnotation = "KGC:";
+	static constexpr std::string_view classAnnotation = "KGC:";
 
-	return getProperties(std::move(annotateMessage), classAnnotation);
+	return getProperties(annotateMessage, classAnnotation);
 }
 
 opt::optional<std::vector<Property>> PropertyParser::getStructProperties(std::string annotateMessage) noexcept
 {
-	static std::string structAnnotation = "KGS:";
+	static constexpr std::string_view structAnnotation = "KGS:";
 
-	return getProperties(std::move(annotateMessage), structAnnotation);
+	return getProperties(annotateMessage, structAnnotation);
 }
 
 opt::optional<std::vector<Property>> PropertyParser::getVariableProperties(std::string annotateMessage) noexcept
 {
-	static std::string variableAnnotation = "KGV:";
+	static constexpr std::string_view variableAnnotation = "KGV:";
 
-	return getProperties(std::move(annotateMessage), variableAnnotation);
+	return getProperties(annotateMessage, variableAnnotation);
 }
 
 opt::optional<std::vector<Property>> PropertyParser::getFieldProperties(std::string annotateMessage) noexcept
 {
-	static std::string fieldAnnotation = "KGF:";
+	static constexpr std::string_view fieldAnnotation = "KGF:";
 
-	return getProperties(std::move(annotateMessage), fieldAnnotation);
+	return getProperties(annotateMessage, fieldAnnotation);
 }
 
 opt::optional<std::vector<Property>> PropertyParser::getFunctionProperties(std::string annotateMessage) noexcept
 {
-	static std::string functionAnnotation = "KGFu:";
+	static constexpr std::string_view functionAnnotation = "KGFu:";
 
-	return getProperties(std::move(annotateMessage), functionAnnotation);
+	return getProperties(annotateMessage, functionAnnotation);
 }
 
 opt::optional<std::vector<Property>> PropertyParser::getMethodProperties(std::string annotateMessage) noexcept
 {
-	static std::string methodAnnotation = "KGM:";
+	static constexpr std::string_view methodAnnotation = "KGM:";
 
-	return getProperties(std::move(annotateMessage), methodAnnotation);
+	return getProperties(annotateMessage, methodAnnotation);
 }
 
 opt::optional<std::vector<Property>> PropertyParser::getEnumProperties(std::string annotateMessage) noexcept
 {
-	static std::string enumAnnotation = "KGE:";
+	static constexpr std::string_view enumAnnotation = "KGE:";
 
-	return getProperties(std::move(annotateMessage), enumAnnotation);
+	return getProperties(annotateMessage, enumAnnotation);
 }
 
 opt::optional<std::vector<Property>> PropertyParser::getEnumValueProperties(std::string annotateMessage) noexcept
 {
-	static std::string enumValueAnnotation = "KGEV:";
+	static constexpr std::string_view enumValueAnnotation = "KGEV:";
 
-	return getProperties(std::move(annotateMessage), enumValueAnnotation);
+	return getProperties(annotateMessage, enumValueAnnotation);
 }
 
-bool PropertyParser::splitProperties(std::string&& propertiesString) noexcept
+bool PropertyParser::splitProperties(std::string_view propertiesString, std::vector<Property>& out_properties) noexcept
 {
-	bool isParsingArgument = false;
+	bool	isParsingArgument	= false;
+	size_t	index				= 0u;
 
-	while (!propertiesString.empty())
+	while (index < propertiesString.size())
 	{
 		if (isParsingArgument)
 		{
-			if (!lookForNextPropertyArgument(propertiesString, isParsingArgument))
+			if (!lookForNextPropertyArgument(propertiesString, index, isParsingArgument, out_properties.back()))
 			{
 				return false;
 			}
 		}
-		else if (!lookForNextProperty(propertiesString, isParsingArgument))
+		else if (!lookForNextProperty(propertiesString, index, isParsingArgument, out_properties))
 		{
 			return false;
 		}
@@ -117,135 +127,92 @@ bool PropertyParser::splitProperties(std::string&& propertiesString) noexcept
 	return true;
 }
 
-bool PropertyParser::lookForNextProperty(std::string& inout_parsingProps, bool& out_isParsingSubProp) noexcept
+bool PropertyParser::lookForNextProperty(std::string_view propertiesString, size_t& inout_index, bool& out_isParsingSubProp, std::vector<Property>& out_properties) noexcept
 {
 	//Find first occurence of propertySeparator or subprop start encloser in string
-	size_t index = inout_parsingProps.find_first_of(_relevantCharsForPropParsing);
+	size_t index = propertiesString.find_first_of(_relevantCharsForPropParsing, inout_index);
 
 	//Was last prop
-	if (index == inout_parsingProps.npos)
+	if (index == propertiesString.npos)
 	{
-		_splitProps.push_back({ inout_parsingProps });
-		inout_parsingProps.clear();
+		index = propertiesString.size();
 	}
-	else if (inout_parsingProps[index] == _propertyParsingSettings->propertySeparator)
-	{
-		_splitProps.push_back({ std::string(inout_parsingProps.cbegin(), inout_parsingProps.cbegin() + index) });
-		inout_parsingProps.erase(0, index + 1);
-	}
-	else	//_propertyParsingSettings->subPropertyEnclosers[0]
+	else if (propertiesString[index] == _propertyParsingSettings->argumentEnclosers[0])
 	{
 		out_isParsingSubProp = true;
-
-		_splitProps.push_back({ std::string(inout_parsingProps.cbegin(), inout_parsingProps.cbegin() + index) });
-		inout_parsingProps.erase(0, index + 1);
 	}
 
-	//Remove start and trail spaces from the added property
-	removeStartSpaces(_splitProps.back().front());
-	removeTrailSpaces(_splitProps.back().front());
+	out_properties.emplace_back(Property{ std::string(trimSpaces(propertiesString.substr(inout_index, index - inout_index))), std::vector<std::string>() });
+
+	//Consume the separator / start encloser
+	inout_index = index + 1;
 
 	return true;
 }
 
-bool PropertyParser::lookForNextPropertyArgument(std::string& inout_parsingProps, bool& out_isParsingSubProp) noexcept
+bool PropertyParser::lookForNextPropertyArgument(std::string_view propertiesString, size_t& inout_index, bool& out_isParsingSubProp, Property& inout_property) noexcept
 {
-	//Find first occurence of propertySeparator or subprop start encloser in string
-	size_t index = inout_parsingProps.find_first_of(_relevantCharsForPropArgsParsing);
+	//Find first occurence of argumentSeparator or subprop end encloser in string
+	size_t index = propertiesString.find_first_of(_relevantCharsForPropArgsParsing, inout_index);
 
 	//Was last prop
-	if (index == inout_parsingProps.npos)
+	if (index == propertiesString.npos)
 	{
 		_parsingErrorDescription = "Subproperty end encloser \"" + std::string(1u, _propertyParsingSettings->argumentEnclosers[1]) + "\" is missing.";
 
 		return false;
 	}
-	else if (inout_parsingProps[index] == _propertyParsingSettings->argumentSeparator)
-	{
-		_splitProps.back().push_back(std::string(inout_parsingProps.cbegin(), inout_parsingProps.cbegin() + index));
 
-		//Remove start and trail spaces from the added sub property
-		removeStartSpaces(_splitProps.back().back());
-		removeTrailSpaces(_splitProps.back().back());
+	inout_property.arguments.emplace_back(trimSpaces(propertiesString.substr(inout_index, index - inout_index)));
 
-		inout_parsingProps.erase(0, index + 1);
+	if (propertiesString[index] == _propertyParsingSettings->argumentSeparator)
+	{
+		inout_index = index + 1;
 	}
 	else	//_propertyParsingSettings->subPropertyEnclosers[1]
 	{
 		out_isParsingSubProp = false;
 
-		_splitProps.back().push_back(std::string(inout_parsingProps.cbegin(), inout_parsingProps.cbegin() + index));
-
-		//Remove start and trail spaces from the added sub property
-		removeStartSpaces(_splitProps.back().back());
-		removeTrailSpaces(_splitProps.back().back());
+		//A single empty argument means that there are no arguments at all
+		if (inout_property.arguments.size() == 1u && inout_property.arguments.front().empty())
+		{
+			inout_property.arguments.clear();
+		}
 
 		//Make sure there is a property separator after the end encloser if is not the last char of the string
-		if (index != inout_parsingProps.size() - 1)
-		{
-			size_t propSeparatorIndex = inout_parsingProps.find_first_not_of(' ', index + 1);
+		size_t propSeparatorIndex = propertiesString.find_first_not_of(' ', index + 1);
 
-			if (inout_parsingProps[propSeparatorIndex] != _propertyParsingSettings->propertySeparator)
-			{
-				_parsingErrorDescription = "Property separator \"" + std::string(1, _propertyParsingSettings->propertySeparator) + "\" is missing between two properties.";
+		if (propSeparatorIndex == propertiesString.npos)
+		{
+			//Only spaces remain, so consume the rest of the string
+			inout_index = propertiesString.size();
+		}
+		else if (propertiesString[propSeparatorIndex] != _propertyParsingSettings->propertySeparator)
+		{
+			_parsingErrorDescription = "Property separator \"" + std::string(1, _propertyParsingSettings->propertySeparator) + "\" is missing between two properties.";
 
-				return false;
-			}
-			else
-			{
-				inout_parsingProps.erase(0, propSeparatorIndex + 1); // + 1 to consume prop separator
-			}
+			return false;
 		}
 		else
 		{
-			//index is the last character, so consume the rest of the string
-			inout_parsingProps.clear();
+			inout_index = propSeparatorIndex + 1; // + 1 to consume prop separator
 		}
 	}
 
 	return true;
 }
 
-void PropertyParser::removeStartSpaces(std::string& toCleanString) const noexcept
-{
-	toCleanString.erase(0, toCleanString.find_first_not_of(' '));
-}
-
-void PropertyParser::removeTrailSpaces(std::string& toCleanString) const noexcept
-{
-	toCleanString.erase(toCleanString.find_last_not_of(' ') + 1);
-}
-
-std::vector<Property> PropertyParser::fillProperties(std::vector<std::vector<std::string>>& splitProps) noexcept
-{
-	std::vector<Property> result;
-
-	for (std::vector<std::string>& props : splitProps)
-	{
-		addProperty(props, result);
-	}
-
-	return result;
-}
-
-void PropertyParser::addProperty(std::vector<std::string>& propertyAsVector, std::vector<Property>& out_properties) noexcept
+std::string_view PropertyParser::trimSpaces(std::string_view toTrimString) noexcept
 {
-	Property prop{std::move(propertyAsVector[0]), std::vector<std::string>()};
+	size_t start = toTrimString.find_first_not_of(' ');
 
-	if (propertyAsVector.size() > 1u)
-	{
-		//Add all arguments to the property
-		//If propertyAsVector has 2 elements and the 2nd element is empty, there are no arguments
-		if (propertyAsVector.size() != 2 || !propertyAsVector[1].empty())
-			prop.arguments.insert(prop.arguments.cend(), std::make_move_iterator(propertyAsVector.begin() + 1), std::make_move_iterator(propertyAsVector.end()));
-	}
-	
-	out_properties.emplace_back(std::move(prop));
+	return (start == toTrimString.npos) ? std::string_view() : toTrimString.substr(start, toTrimString.find_last_not_of(' ') - start + 1);
 }
 
 void PropertyParser::setup(PropertyParsingSettings const& propertyParsingSettings) noexcept
 {
 	_propertyParsingSettings			= &propertyParsingSettings;
+	_parsingDuration					= 0.0f;
 
 	char charsForPropParsing[] =
 	{
@@ -265,11 +232,15 @@ void PropertyParser::setup(PropertyParsingSettings const& propertyParsingSetting
 
 void PropertyParser::clean() noexcept
 {
-	_splitProps.clear();
 	_parsingErrorDescription.clear();
 }
 
 std::string const& PropertyParser::getParsingErrorDescription() const noexcept
 {
 	return _parsingErrorDescription;
+}
+
+float PropertyParser::getParsingDuration() const noexcept
+{
+	return _parsingDuration;
 }
\ No newline at end of file
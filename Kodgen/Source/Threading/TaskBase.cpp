@@ -11,4 +11,14 @@ TaskBase::TaskBase(char const* name, std::vector<std::shared_ptr<TaskBase>>&& de
 std::string const& TaskBase::getName() const noexcept
 {
 	return _name;
+}
+
+std::string const& TaskBase::getDescription() const noexcept
+{
+	return _description;
+}
+
+void TaskBase::setDescription(std::string description) noexcept
+{
+	_description = std::move(description);
 }
\ No newline at end of file
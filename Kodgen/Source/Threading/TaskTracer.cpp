@@ -0,0 +1,95 @@
+#include "Kodgen/Threading/TaskTracer.h"
+
+#include "Kodgen/Misc/Helpers.h"
+
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+using namespace kodgen;
+
+TaskTracer::TaskTracer() noexcept:
+	_origin{Clock::now()}
+{
+}
+
+void TaskTracer::recordEvent(std::string name, std::string category, std::string detail, TimePoint begin, TimePoint end) noexcept
+{
+	std::thread::id threadId = std::this_thread::get_id();
+
+	std::lock_guard lock(_eventsMutex);
+
+	_events.push_back(Event{std::move(name), std::move(category), std::move(detail), threadId, begin, end});
+}
+
+void TaskTracer::clear() noexcept
+{
+	std::lock_guard lock(_eventsMutex);
+
+	_events.clear();
+	_origin = Clock::now();
+}
+
+std::string TaskTracer::getChromeTraceJson() const noexcept
+{
+	auto toMicroseconds = [this](TimePoint timePoint) -> long long
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(timePoint - _origin).count();
+	};
+
+	std::lock_guard lock(_eventsMutex);
+
+	//Map thread ids to small integers in order of appearance so that the viewer displays readable thread names
+	std::unordered_map<std::thread::id, uint32>	threadIndices;
+	std::ostringstream							stream;
+
+	stream << "{\"traceEvents\":[";
+
+	for (size_t i = 0u; i < _events.size(); i++)
+	{
+		Event const&	event		= _events[i];
+		auto			threadIt	= threadIndices.try_emplace(event.threadId, static_cast<uint32>(threadIndices.size())).first;
+
+		stream	<< ((i == 0u) ? "" : ",")
+				<< "{\"name\":" << Helpers::toJsonString(event.name)
+				<< ",\"cat\":" << Helpers::toJsonString(event.category)
+				<< ",\"ph\":\"X\""
+				<< ",\"ts\":" << toMicroseconds(event.begin)
+				<< ",\"dur\":" << std::chrono::duration_cast<std::chrono::microseconds>(event.end - event.begin).count()
+				<< ",\"pid\":0"
+				<< ",\"tid\":" << threadIt->second;
+
+		if (!event.detail.empty())
+		{
+			stream << ",\"args\":{\"file\":" << Helpers::toJsonString(event.detail) << "}";
+		}
+
+		stream << "}";
+	}
+
+	//Name each thread
+	for (auto const& [threadId, threadIndex] : threadIndices)
+	{
+		stream	<< ((_events.empty()) ? "" : ",")
+				<< "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << threadIndex
+				<< ",\"args\":{\"name\":\"Thread " << threadIndex << "\"}}";
+	}
+
+	stream << "],\"displayTimeUnit\":\"ms\"}";
+
+	return stream.str();
+}
+
+bool TaskTracer::exportChromeTrace(fs::path const& outputFile) const noexcept
+{
+	std::ofstream stream(outputFile, std::ios::out | std::ios::trunc);
+
+	if (stream.is_open())
+	{
+		stream << getChromeTraceJson();
+
+		return stream.good();
+	}
+
+	return false;
+}
\ No newline at end of file
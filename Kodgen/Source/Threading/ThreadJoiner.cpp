@@ -0,0 +1,35 @@
+#include "Kodgen/Threading/ThreadJoiner.h"
+
+using namespace kodgen;
+
+ThreadJoiner::~ThreadJoiner() noexcept
+{
+	joinAll();
+}
+
+void ThreadJoiner::adopt(std::thread&& thread) noexcept
+{
+	if (thread.joinable())
+	{
+		std::lock_guard lock(_mutex);
+
+		_threads.emplace_back(std::move(thread));
+	}
+}
+
+void ThreadJoiner::joinAll() noexcept
+{
+	std::vector<std::thread> threads;
+
+	{
+		std::lock_guard lock(_mutex);
+
+		threads.swap(_threads);
+	}
+
+	//Join outside of the lock so that threads can still be adopted meanwhile
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
\ No newline at end of file
@@ -55,7 +55,18 @@ void ThreadPool::workerRoutine() noexcept
 				//Release the mutex before executing the task to allow other workers to grab tasks during execution
 				lock.unlock();
 
-				task->execute();
+				if (TaskTracer* taskTracer = _taskTracer.load())
+				{
+					TaskTracer::TimePoint begin = TaskTracer::Clock::now();
+
+					task->execute();
+
+					taskTracer->recordEvent(task->getName(), "Task", task->getDescription(), begin, TaskTracer::Clock::now());
+				}
+				else
+				{
+					task->execute();
+				}
 
 				lock.lock();
 			}
@@ -145,4 +156,9 @@ void ThreadPool::setIsRunning(bool isRunning) noexcept
 			_taskCondition.notify_all();
 		}
 	}
+}
+
+void ThreadPool::setTaskTracer(TaskTracer* taskTracer) noexcept
+{
+	_taskTracer.store(taskTracer);
 }
\ No newline at end of file